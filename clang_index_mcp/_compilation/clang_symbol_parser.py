@@ -2,13 +2,15 @@
 
 import json
 import re
+from ctypes import POINTER, ArgumentError, byref, c_uint
 from dataclasses import dataclass
+from functools import lru_cache
 from typing import TYPE_CHECKING, Any, Callable, Dict, List, Optional, Tuple
 
 from clang.cindex import Cursor, CursorKind, TranslationUnit, Type
 
 from .._core import diagnostics
-from .._symbols.model import SymbolInfo
+from .._symbols.model import CLASS_KINDS, SymbolInfo, template_parameter_names
 from .._symbols.ports.parser import CallSiteRecord, ParseResult, SymbolParser, TypeAliasRecord
 from .._symbols.alias_extractor import extract_alias_info
 from .._symbols.cursor_utils import extract_namespace, get_qualified_name
@@ -23,6 +25,51 @@ if TYPE_CHECKING:
     from .._symbols.symbol_index_store import SymbolIndexStore
 
 
+@lru_cache(maxsize=None)
+def _overridden_cursor_functions() -> Optional[Tuple[Any, Any]]:
+    """clang_getOverriddenCursors and clang_disposeOverriddenCursors, bound once.
+
+    The Python bindings do not wrap them, so their C signatures are declared
+    here.  Bound on first use rather than at import: reading conf.lib loads
+    libclang, whose path libclang_setup may not have configured yet.
+    Returns None, with a warning, if the loaded libclang lacks them.
+    """
+    from clang import cindex
+
+    try:
+        get_overridden = cindex.conf.lib.clang_getOverriddenCursors
+        dispose = cindex.conf.lib.clang_disposeOverriddenCursors
+    except AttributeError as e:
+        diagnostics.warning(f"libclang has no overridden cursor API, overrides not recorded: {e}")
+        return None
+    get_overridden.argtypes = [Cursor, POINTER(POINTER(Cursor)), POINTER(c_uint)]
+    get_overridden.restype = None
+    dispose.argtypes = [POINTER(Cursor)]
+    dispose.restype = None
+    return get_overridden, dispose
+
+
+def _overridden_method_usrs(cursor: Cursor) -> List[str]:
+    """USRs of the base class methods a virtual method directly overrides."""
+    functions = _overridden_cursor_functions()
+    if functions is None:
+        return []
+    get_overridden, dispose = functions
+    overridden = POINTER(Cursor)()
+    count = c_uint(0)
+    try:
+        get_overridden(cursor, byref(overridden), byref(count))
+    except ArgumentError as e:
+        diagnostics.error(f"clang_getOverriddenCursors failed for {cursor.spelling}: {e}")
+        return []
+    if not count.value:
+        return []
+    try:
+        return [usr for usr in (overridden[i].get_usr() for i in range(count.value)) if usr]
+    finally:
+        dispose(overridden)
+
+
 @dataclass
 class LineRangeInfo:
     """Line range and location information extracted from a cursor."""
@@ -141,24 +188,13 @@ class ClangSymbolParser(SymbolParser):
         return base_classes
 
     def _find_primary_template_info(self, primary_template_usr: str) -> Optional[SymbolInfo]:
-        """Look up the primary template in class_index by USR."""
+        """Look up the primary template class by USR."""
         with self.index_lock:
-            for name, infos in self.class_index.items():
-                for info in infos:
-                    if info.usr == primary_template_usr:
-                        return info
+            info = self.symbol_store.usr_index.get(primary_template_usr)
+        if info is not None and info.kind in CLASS_KINDS:
+            return info
         return None
 
-    def _parse_template_params(self, primary_info: SymbolInfo) -> List[dict]:
-        """Parse template_parameters JSON from a primary template info."""
-        if not primary_info.template_parameters:
-            return []
-        try:
-            result: List[Dict[str, Any]] = json.loads(primary_info.template_parameters)
-            return result
-        except (json.JSONDecodeError, TypeError):
-            return []
-
     def _resolve_instantiation_base_classes(
         self, cursor: Cursor, primary_template_usr: Optional[str]
     ) -> List[str]:
@@ -174,11 +210,11 @@ class ClangSymbolParser(SymbolParser):
         if not primary_info:
             return []
 
-        template_params = self._parse_template_params(primary_info)
-        if not template_params:
+        param_names = template_parameter_names(primary_info.template_parameters)
+        if not param_names:
             return []
 
-        param_to_arg = TemplateResolver.build_param_mapping(template_params, template_args)
+        param_to_arg = TemplateResolver.build_param_mapping_from_names(param_names, template_args)
 
         return TemplateResolver.substitute_in_bases(
             primary_info.base_classes, param_to_arg, template_args
@@ -695,6 +731,7 @@ class ClangSymbolParser(SymbolParser):
                 is_pure_virtual=is_pure_virtual,
                 is_const=is_const,
                 is_static=is_static,
+                overridden_usrs=_overridden_method_usrs(cursor) if is_virtual else [],
                 is_definition=cursor.is_definition(),
                 brief=doc_info["brief"],
                 doc_comment=doc_info["doc_comment"],
@@ -9,7 +9,7 @@ suitable for use across architectural layers.
 """
 
 import re
-from typing import Any, Dict, List
+from typing import Any, Dict, List, Sequence
 
 
 class TemplateResolver:
@@ -74,13 +74,25 @@ class TemplateResolver:
         Returns:
             Dict mapping parameter names to argument strings.
         """
-        param_to_arg: Dict[str, str] = {}
-        for i, param in enumerate(template_params):
-            if i < len(template_args):
-                param_name = param.get("name", "")
-                if param_name:
-                    param_to_arg[param_name] = template_args[i]
-        return param_to_arg
+        return TemplateResolver.build_param_mapping_from_names(
+            [param.get("name", "") for param in template_params], template_args
+        )
+
+    @staticmethod
+    def build_param_mapping_from_names(
+        param_names: Sequence[str], template_args: List[str]
+    ) -> Dict[str, str]:
+        """Build mapping from template parameter names to template arguments.
+
+        Args:
+            param_names: Parameter names in declaration order ("" for unnamed
+                parameters, which are skipped).
+            template_args: List of actual argument strings.
+
+        Returns:
+            Dict mapping parameter names to argument strings.
+        """
+        return {name: arg for name, arg in zip(param_names, template_args) if name}
 
     @staticmethod
     def substitute_in_bases(
@@ -101,6 +101,13 @@ class CacheBackend(Protocol):
         """
         ...
 
+    def load_symbols_by_usrs(self, usrs: List[str]) -> Dict[str, SymbolInfo]:
+        """Load several symbols by USR in one round trip, keyed by USR.
+
+        USRs that are not stored are missing from the result.
+        """
+        ...
+
     def set_compile_args_hash(self, file_path: str, args_hash: str) -> bool:
         """Store or update the compile arguments hash for a file."""
         ...
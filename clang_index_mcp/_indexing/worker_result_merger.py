@@ -193,10 +193,7 @@ class WorkerResultMerger:
             with self.symbol_store.index_lock:
                 # CRITICAL: Clear old entries for this file FIRST (before adding new symbols)
                 # This ensures that modified files don't have duplicate/stale symbols
-                self.symbol_store.clear_file_index_entries(file_path)
-
-                for symbol in symbols:
-                    self.symbol_store.merge_symbol_into_indexes(symbol)
+                self.symbol_store.merge_file_symbols(file_path, symbols)
 
             if call_sites:
                 self.call_graph_service.stream_call_sites(file_path, call_sites)
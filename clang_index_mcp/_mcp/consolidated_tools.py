@@ -9,11 +9,17 @@ Tool mapping (public      -> internal):
   find_symbols_by_pattern -> search_classes / search_functions / search_symbols
   find_in_file            -> passthrough
   get_class_info          -> passthrough
+  get_class_info_batch    -> passthrough
   get_class_hierarchy     -> passthrough
   get_type_alias_info     -> passthrough
-  find_outgoing_calls     -> find_outgoing_calls / get_call_sites
-  find_incoming_calls     -> passthrough
+  list_namespaces         -> passthrough
+  find_outgoing_calls     -> find_outgoing_calls / get_call_sites / find_transitive_calls
+  find_incoming_calls     -> find_incoming_calls / find_transitive_calls /
+                             find_template_call_sites
   trace_execution_path    -> get_call_path
+  get_call_hotspots       -> passthrough
+  get_class_hierarchy_stats -> passthrough
+  find_overrides          -> passthrough
 """
 
 import json
@@ -29,8 +35,13 @@ from .._mcp.tool_registry import ToolRegistry
 _PASSTHROUGH_MAP = {
     "find_in_file": "find_in_file",
     "get_class_info": "get_class_info",
+    "get_class_info_batch": "get_class_info_batch",
     "get_class_hierarchy": "get_class_hierarchy",
     "get_type_alias_info": "get_type_alias_info",
+    "list_namespaces": "list_namespaces",
+    "get_call_hotspots": "get_call_hotspots",
+    "get_class_hierarchy_stats": "get_class_hierarchy_stats",
+    "find_overrides": "find_overrides",
 }
 
 # Default sync timeout for set_project (seconds)
@@ -38,7 +49,7 @@ _DEFAULT_SYNC_TIMEOUT = 30
 
 # Consolidated params that must not be forwarded to internal handlers
 _SEARCH_CONSOLIDATED_PARAMS = {"target_type", "output_detail_level"}
-_CALLGRAPH_CONSOLIDATED_PARAMS = {"return_format"}
+_CALLGRAPH_CONSOLIDATED_PARAMS = {"return_format", "max_depth"}
 
 # Fields to strip at each output_detail_level
 _DOC_FIELDS = {"brief", "doc_comment"}
@@ -76,11 +87,16 @@ TOOL_NAMES = [
     "find_symbols_by_pattern",
     "find_in_file",
     "get_class_info",
+    "get_class_info_batch",
     "get_class_hierarchy",
     "get_type_alias_info",
+    "list_namespaces",
     "find_outgoing_calls",
     "find_incoming_calls",
     "trace_execution_path",
+    "get_call_hotspots",
+    "get_class_hierarchy_stats",
+    "find_overrides",
 ]
 
 
@@ -155,7 +171,7 @@ def _add_system_state(result: List[TextContent]) -> List[TextContent]:
 
 
 def list_tools_b() -> List[Tool]:
-    """Return consolidated tool definitions (10 tools)."""
+    """Return consolidated tool definitions (15 tools)."""
     return [
         Tool(
             name="set_project",
@@ -371,6 +387,31 @@ def list_tools_b() -> List[Tool]:
                 "required": ["class_name"],
             },
         ),
+        Tool(
+            name="get_class_info_batch",
+            description=(
+                "Get full details (as get_class_info returns them) of several classes in one "
+                "request.\n\n"
+                "Use this instead of calling get_class_info repeatedly when you need the "
+                "details of a known list of classes, e.g. all classes of a module or all "
+                "subclasses returned by get_class_hierarchy. Each entry carries the requested "
+                "class_name; names that are not found or are ambiguous get a per-entry error."
+            ),
+            inputSchema={
+                "type": "object",
+                "properties": {
+                    "class_names": {
+                        "type": "array",
+                        "items": {"type": "string"},
+                        "description": (
+                            "Exact class names (simple or qualified, "
+                            "e.g. ['DataRecord', 'storage::DataStore'])."
+                        ),
+                    },
+                },
+                "required": ["class_names"],
+            },
+        ),
         Tool(
             name="get_class_hierarchy",
             description=(
@@ -453,6 +494,37 @@ def list_tools_b() -> List[Tool]:
                 "required": ["type_name"],
             },
         ),
+        Tool(
+            name="list_namespaces",
+            description=(
+                "List C++ namespaces with the number of classes and functions declared "
+                "directly in each, plus total_symbols including nested namespaces.\n\n"
+                "Use this to get an overview of how a codebase is organized before searching, "
+                "or to find the right value for the namespace filter of "
+                "find_symbols_by_pattern. The global namespace is listed as ''."
+            ),
+            inputSchema={
+                "type": "object",
+                "properties": {
+                    "namespace": {
+                        "type": "string",
+                        "description": (
+                            "Optional: Only list this namespace and namespaces nested in it "
+                            "(e.g. 'app' lists 'app', 'app::ui', 'app::ui::detail')."
+                        ),
+                    },
+                    "search_scope": {
+                        "type": "string",
+                        "enum": ["project_code_only", "include_external_libraries"],
+                        "description": (
+                            "'project_code_only' (default): count project symbols only. "
+                            "'include_external_libraries': include system/third-party."
+                        ),
+                        "default": "project_code_only",
+                    },
+                },
+            },
+        ),
         Tool(
             name="find_outgoing_calls",
             description=(
@@ -468,7 +540,9 @@ def list_tools_b() -> List[Tool]:
                 "Return format:\n"
                 "- 'function_definitions_summary' (default): callee names + file locations\n"
                 "- 'function_definitions_full': complete signatures + metadata\n"
-                "- 'exact_call_line_locations': file:line:column of every call within the function"
+                "- 'exact_call_line_locations': file:line:column of every call within the function\n\n"
+                "Set max_depth > 1 for everything X reaches transitively, grouped by call "
+                "distance and by file (one call instead of repeated queries)."
             ),
             inputSchema={
                 "type": "object",
@@ -502,6 +576,17 @@ def list_tools_b() -> List[Tool]:
                         "description": "Optional: Maximum results.",
                         "minimum": 1,
                     },
+                    "max_depth": {
+                        "type": "integer",
+                        "description": (
+                            "Optional: Call distance to follow (default: 1, direct only). "
+                            "Values > 1 return the transitive closure grouped by depth; "
+                            "max_results then caps the functions reached (default: 500)."
+                        ),
+                        "minimum": 1,
+                        "maximum": 10,
+                        "default": 1,
+                    },
                     "search_scope": {
                         "type": "string",
                         "enum": ["project_code_only", "include_external_libraries"],
@@ -525,7 +610,14 @@ def list_tools_b() -> List[Tool]:
                 "Direction quick reference:\n"
                 "- Y calls X -> find_incoming_calls (this tool, X is the subject)\n"
                 "- X calls Y -> find_outgoing_calls (other tool, X is the subject)\n\n"
-                "Call directly when function name is known from the query; do not search first."
+                "Call directly when function name is known from the query; do not search first.\n\n"
+                "Set max_depth > 1 for impact analysis: every function that reaches X "
+                "transitively, grouped by call distance and by file, in one call.\n\n"
+                "Set template_type to find calls to an external template instantiated with "
+                "a project type, e.g. function_name='make_shared', template_type='Sensor' "
+                "for every std::make_shared<Sensor>(...).\n\n"
+                "Set include_virtual_dispatch for a method override: calls made through the "
+                "base class virtual it overrides are added, marked with via_virtual."
             ),
             inputSchema={
                 "type": "object",
@@ -541,8 +633,46 @@ def list_tools_b() -> List[Tool]:
                     },
                     "max_results": {
                         "type": "integer",
-                        "description": "Optional: Maximum results.",
+                        "description": (
+                            "Optional: Page size of direct callers. Returns at most this "
+                            "many call sites (in file/line order) and their callers, plus "
+                            "next_cursor while more remain."
+                        ),
+                        "minimum": 1,
+                    },
+                    "cursor": {
+                        "type": "string",
+                        "description": (
+                            "Optional: next_cursor from the previous response, to fetch "
+                            "the next page of call sites."
+                        ),
+                    },
+                    "max_depth": {
+                        "type": "integer",
+                        "description": (
+                            "Optional: Call distance to follow (default: 1, direct only). "
+                            "Values > 1 return the transitive closure grouped by depth; "
+                            "max_results then caps the functions reached (default: 500)."
+                        ),
                         "minimum": 1,
+                        "maximum": 10,
+                        "default": 1,
+                    },
+                    "include_virtual_dispatch": {
+                        "type": "boolean",
+                        "description": (
+                            "Optional: Also return callers of the base class methods the "
+                            "target overrides (calls that may dispatch to it at runtime)."
+                        ),
+                        "default": False,
+                    },
+                    "template_type": {
+                        "type": "string",
+                        "description": (
+                            "Optional: Project type used as a template argument "
+                            "(qualified or unqualified). Returns the template call sites "
+                            "instantiated with it; function_name may then be empty."
+                        ),
                     },
                     "search_scope": {
                         "type": "string",
@@ -559,14 +689,15 @@ def list_tools_b() -> List[Tool]:
         Tool(
             name="trace_execution_path",
             description=(
-                "Find execution paths between a source and target function using BFS. "
-                "Returns all call chains from source to target within max_depth hops.\n\n"
+                "Find execution paths between a source and target function. "
+                "Returns the shortest call chains from source to target within max_depth "
+                "hops, shortest first (up to 10 by default).\n\n"
                 "Use when both source and target are known and you need paths between them. "
                 "If you only need what X calls, use find_outgoing_calls instead.\n\n"
                 "Example: trace_execution_path('main', 'loadConfig') might "
                 "return: main -> init -> setup -> loadConfig\n\n"
-                "WARNING: Can return many paths in highly connected code. "
-                "Keep max_depth low (5-15)."
+                "Searches in highly connected code stop at a node budget and timeout, "
+                "returning the paths found so far. Keep max_depth low (5-15)."
             ),
             inputSchema={
                 "type": "object",
@@ -590,6 +721,107 @@ def list_tools_b() -> List[Tool]:
                 "required": ["source_function", "target_function"],
             },
         ),
+        Tool(
+            name="get_call_hotspots",
+            description=(
+                "Project-wide call graph hotspots: the most called functions (call_count), "
+                "the functions making the most calls (calls_made, fan-out outliers) and "
+                "function definitions with no indexed callers (dead code candidates).\n\n"
+                "Use this for an overview of central or suspicious code before drilling down "
+                "with find_incoming_calls / find_outgoing_calls. Answered from call counters "
+                "kept in the index, so it is fast on large codebases."
+            ),
+            inputSchema={
+                "type": "object",
+                "properties": {
+                    "max_results": {
+                        "type": "integer",
+                        "description": "Functions per list (default: 10, max: 100).",
+                        "default": 10,
+                    },
+                    "search_scope": {
+                        "type": "string",
+                        "enum": ["project_code_only", "include_external_libraries"],
+                        "description": (
+                            "'project_code_only' (default): rank project functions only. "
+                            "'include_external_libraries': also rank system/third-party "
+                            "functions (e.g. most called library calls)."
+                        ),
+                        "default": "project_code_only",
+                    },
+                },
+            },
+        ),
+        Tool(
+            name="get_class_hierarchy_stats",
+            description=(
+                "Project-wide inheritance overview: class counts by inheritance depth, the "
+                "deepest classes and the widest base classes/interfaces ranked by their "
+                "number of direct and transitive subclasses.\n\n"
+                "Use this to find the central interfaces of a codebase before exploring one "
+                "with get_class_hierarchy. Answered from an inheritance closure computed once "
+                "per index update, so it is fast on large codebases."
+            ),
+            inputSchema={
+                "type": "object",
+                "properties": {
+                    "max_results": {
+                        "type": "integer",
+                        "description": "Classes per list (default: 10, max: 100).",
+                        "default": 10,
+                    },
+                    "search_scope": {
+                        "type": "string",
+                        "enum": ["project_code_only", "include_external_libraries"],
+                        "description": (
+                            "'project_code_only' (default): report project classes only. "
+                            "'include_external_libraries': also report system/third-party "
+                            "base classes (e.g. widely derived library interfaces)."
+                        ),
+                        "default": "project_code_only",
+                    },
+                },
+            },
+        ),
+        Tool(
+            name="find_overrides",
+            description=(
+                "Find every override of a virtual method across the class hierarchy, "
+                "including overrides of overrides, with their locations and the method each "
+                "one directly overrides.\n\n"
+                "Use this instead of get_class_hierarchy followed by get_class_info for every "
+                "subclass. Answered from the overrides recorded by the compiler at index time "
+                "in a single indexed query."
+            ),
+            inputSchema={
+                "type": "object",
+                "properties": {
+                    "function_name": {
+                        "type": "string",
+                        "description": "Name of the virtual method (e.g. 'draw').",
+                    },
+                    "class_name": {
+                        "type": "string",
+                        "description": (
+                            "Optional: Class declaring the method (e.g. 'Shape'), to select "
+                            "one method among several with the same name."
+                        ),
+                        "default": "",
+                    },
+                    "search_scope": {
+                        "type": "string",
+                        "enum": ["project_code_only", "include_external_libraries"],
+                        "description": (
+                            "'project_code_only' (default): report overrides in project code "
+                            "only. 'include_external_libraries': also report overrides in "
+                            "system/third-party code."
+                        ),
+                        "default": "project_code_only",
+                    },
+                },
+                "required": ["function_name"],
+            },
+        ),
     ]
 
 
@@ -740,6 +972,9 @@ async def _handle_find_outgoing_calls(
 
     return_format = arguments.get("return_format", "function_definitions_summary")
 
+    if arguments.get("max_depth", 1) > 1 and return_format != "exact_call_line_locations":
+        return await _call_transitive(arguments, "callees")
+
     if return_format == "exact_call_line_locations":
         # Route to get_call_sites (only needs function_name + class_name)
         call_sites_args = {
@@ -768,11 +1003,39 @@ async def _handle_find_outgoing_calls(
 async def _handle_find_incoming_calls(
     arguments: Dict[str, Any],
 ) -> List[TextContent]:
-    """Translate find_incoming_calls -> find_incoming_calls (rename only)."""
+    """Translate find_incoming_calls -> find_incoming_calls, find_transitive_calls
+    when max_depth > 1, or find_template_call_sites when template_type is set."""
+
+    if arguments.get("template_type"):
+        template_args = {
+            "template_type": arguments["template_type"],
+            "function_name": arguments.get("function_name", ""),
+        }
+        return cast(
+            List[TextContent],
+            await ToolRegistry.call_tool(
+                "_handle_tool_call", "find_template_call_sites", template_args
+            ),
+        )
+
+    if arguments.get("max_depth", 1) > 1:
+        return await _call_transitive(arguments, "callers")
+
+    schema_a_args = {k: v for k, v in arguments.items() if k != "max_depth"}
+    return cast(
+        List[TextContent],
+        await ToolRegistry.call_tool("_handle_tool_call", "find_incoming_calls", schema_a_args),
+    )
+
+
+async def _call_transitive(arguments: Dict[str, Any], direction: str) -> List[TextContent]:
+    """Route a max_depth > 1 call graph query to find_transitive_calls."""
 
+    schema_a_args = {k: v for k, v in arguments.items() if k != "return_format"}
+    schema_a_args["direction"] = direction
     return cast(
         List[TextContent],
-        await ToolRegistry.call_tool("_handle_tool_call", "find_incoming_calls", arguments),
+        await ToolRegistry.call_tool("_handle_tool_call", "find_transitive_calls", schema_a_args),
     )
 
 
@@ -133,14 +133,23 @@ from .query_policy import _check_tool_readiness  # noqa: E402
 from .tool_handlers.search_tools import (  # noqa: E402
     _handle_find_in_file,
     _handle_get_class_info,
+    _handle_get_class_info_batch,
     _handle_get_type_alias_info,
+    _handle_list_namespaces,
     _handle_search_classes,
     _handle_search_functions,
     _handle_search_symbols,
 )
-from .tool_handlers.hierarchy_tools import _handle_get_class_hierarchy  # noqa: E402
+from .tool_handlers.hierarchy_tools import (  # noqa: E402
+    _handle_find_overrides,
+    _handle_get_class_hierarchy,
+    _handle_get_class_hierarchy_stats,
+)
 from .tool_handlers.call_graph_tools import (  # noqa: E402
     _handle_find_incoming_calls,
+    _handle_find_template_call_sites,
+    _handle_find_transitive_calls,
+    _handle_get_call_hotspots,
     _handle_get_call_path,
     _handle_get_call_sites,
     _handle_get_outgoing_calls,
@@ -176,17 +185,24 @@ async def _handle_tool_call(name: str, arguments: Dict[str, Any]) -> List[TextCo
             "search_classes": _handle_search_classes,
             "search_functions": _handle_search_functions,
             "get_class_info": _handle_get_class_info,
+            "get_class_info_batch": _handle_get_class_info_batch,
             "get_type_alias_info": _handle_get_type_alias_info,
+            "list_namespaces": _handle_list_namespaces,
             "search_symbols": _handle_search_symbols,
             "find_in_file": _handle_find_in_file,
             "refresh_project": _handle_refresh_project,
             "check_system_status": _handle_check_system_status,
             "wait_for_indexing": _handle_wait_for_indexing,
             "get_class_hierarchy": _handle_get_class_hierarchy,
+            "get_class_hierarchy_stats": _handle_get_class_hierarchy_stats,
+            "find_overrides": _handle_find_overrides,
             "find_incoming_calls": _handle_find_incoming_calls,
             "get_outgoing_calls": _handle_get_outgoing_calls,
             "get_call_sites": _handle_get_call_sites,
             "get_call_path": _handle_get_call_path,
+            "find_transitive_calls": _handle_find_transitive_calls,
+            "get_call_hotspots": _handle_get_call_hotspots,
+            "find_template_call_sites": _handle_find_template_call_sites,
         }
 
         if name in handlers:
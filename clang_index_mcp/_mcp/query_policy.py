@@ -96,7 +96,9 @@ def _check_tool_readiness(name: str) -> Optional[List[TextContent]]:
         "search_classes",
         "search_functions",
         "get_class_info",
+        "get_class_info_batch",
         "get_type_alias_info",
+        "list_namespaces",
         "search_symbols",
         "find_in_file",
         "get_class_hierarchy",
@@ -104,6 +106,11 @@ def _check_tool_readiness(name: str) -> Optional[List[TextContent]]:
         "get_outgoing_calls",
         "get_call_path",
         "get_call_sites",
+        "find_transitive_calls",
+        "get_call_hotspots",
+        "get_class_hierarchy_stats",
+        "find_overrides",
+        "find_template_call_sites",
     }
 
     if name in query_tools:
@@ -1,6 +1,7 @@
 """Call-graph MCP tool handlers."""
 
 import asyncio
+import functools
 import json
 from typing import Any, Callable, Dict, List, Optional
 
@@ -114,14 +115,24 @@ async def _handle_call_graph_query(
 async def _handle_find_incoming_calls(arguments: Dict[str, Any]) -> List[TextContent]:
     analyzer = ctx.analyzer
     assert analyzer is not None
-    return await _handle_call_graph_query(
-        arguments=arguments,
-        analyzer_method=analyzer.find_incoming_calls,
-        result_key="callers",
-        tool_name="find_incoming_calls",
-        entity_name="caller",
-        suggestion_func=suggestions.for_find_incoming_calls,
-    )
+    # max_results pages the call sites (keyset order by file and line); the
+    # response carries next_cursor while more call sites remain
+    try:
+        return await _handle_call_graph_query(
+            arguments=arguments,
+            analyzer_method=functools.partial(
+                analyzer.find_incoming_calls,
+                include_virtual_dispatch=bool(arguments.get("include_virtual_dispatch", False)),
+                page_size=arguments.get("max_results"),
+                cursor=arguments.get("cursor") or None,
+            ),
+            result_key="callers",
+            tool_name="find_incoming_calls",
+            entity_name="caller",
+            suggestion_func=suggestions.for_find_incoming_calls,
+        )
+    except ValueError as e:
+        return [TextContent(type="text", text=f"Error: {e}")]
 
 
 async def _handle_get_outgoing_calls(arguments: Dict[str, Any]) -> List[TextContent]:
@@ -137,6 +148,59 @@ async def _handle_get_outgoing_calls(arguments: Dict[str, Any]) -> List[TextCont
     )
 
 
+async def _handle_find_transitive_calls(arguments: Dict[str, Any]) -> List[TextContent]:
+    """Transitive callers (direction="callers") or callees of a function, grouped by depth."""
+    analyzer = ctx.analyzer
+    assert analyzer is not None
+    loop = asyncio.get_event_loop()
+    function_name = str(arguments["function_name"])
+    class_name = str(arguments.get("class_name", ""))
+    direction = arguments.get("direction", "callers")
+    max_depth = int(arguments.get("max_depth", 3))
+    max_nodes = int(arguments.get("max_results") or 500)
+    project_only = _parse_search_scope(arguments)
+    if direction == "callers":
+        analyzer_method = analyzer.find_transitive_callers
+    else:
+        analyzer_method = analyzer.find_transitive_callees
+
+    def run(project_only: bool) -> Dict[str, Any]:
+        return analyzer_method(function_name, class_name, max_depth, max_nodes, project_only)
+
+    # Run synchronous method in executor to avoid blocking event loop
+    with ctx.state_manager.tool_execution():
+        results = dict(await loop.run_in_executor(None, lambda: run(project_only)))
+        function_found = results.pop("_function_found", False)
+        has_any_in_graph = results.pop("_has_any_in_graph", False)
+        results.pop("_target_qualified_name", None)
+
+        # Auto-expand, as for direct callers/callees
+        if project_only and not results["total"] and function_found and has_any_in_graph:
+            results = dict(await loop.run_in_executor(None, lambda: run(False)))
+            for key in ("_function_found", "_has_any_in_graph", "_target_qualified_name"):
+                results.pop(key, None)
+            results["search_note"] = (
+                "Project-only search yielded 0 results. "
+                "Auto-expanded to include external libraries."
+            )
+
+    if not function_found:
+        results["metadata"] = {
+            "suggestions": [
+                f"No function named '{function_name}' found. "
+                "Verify the name with find_symbols_by_pattern."
+            ],
+        }
+    elif results["truncated"]:
+        results["metadata"] = {
+            "suggestions": [
+                f"Stopped after {max_nodes} functions. "
+                "Lower max_depth or raise max_results for the full closure."
+            ],
+        }
+    return [TextContent(type="text", text=json.dumps(results, indent=2))]
+
+
 async def _handle_get_call_sites(arguments: Dict[str, Any]) -> List[TextContent]:
     analyzer = ctx.analyzer
     assert analyzer is not None
@@ -175,3 +239,41 @@ async def _handle_get_call_path(arguments: Dict[str, Any]) -> List[TextContent]:
             ),
         }
     return [TextContent(type="text", text=json.dumps(output_paths, indent=2))]
+
+
+async def _handle_get_call_hotspots(arguments: Dict[str, Any]) -> List[TextContent]:
+    """Most called functions, fan-out outliers and dead code candidates."""
+    analyzer = ctx.analyzer
+    assert analyzer is not None
+    loop = asyncio.get_event_loop()
+    limit = max(1, min(int(arguments.get("max_results") or 10), 100))
+    project_only = _parse_search_scope(arguments)
+    # Run synchronous method in executor to avoid blocking event loop
+    with ctx.state_manager.tool_execution():
+        hotspots = await loop.run_in_executor(
+            None, lambda: analyzer.get_call_hotspots(limit, project_only)
+        )
+    if hotspots["uncalled"]:
+        hotspots["metadata"] = {
+            "suggestions": [
+                "Functions in 'uncalled' have no indexed callers. They may still be reached "
+                "through function pointers, callbacks or code outside the index; verify with "
+                "find_incoming_calls before removing them."
+            ],
+        }
+    return [TextContent(type="text", text=json.dumps(hotspots, indent=2))]
+
+
+async def _handle_find_template_call_sites(arguments: Dict[str, Any]) -> List[TextContent]:
+    """Calls to external templates (std::make_shared, ...) instantiated with a project type."""
+    analyzer = ctx.analyzer
+    assert analyzer is not None
+    loop = asyncio.get_event_loop()
+    type_name = arguments["template_type"]
+    function_name = arguments.get("function_name", "")
+    # Run synchronous method in executor to avoid blocking event loop
+    with ctx.state_manager.tool_execution():
+        result = await loop.run_in_executor(
+            None, lambda: analyzer.find_template_call_sites(type_name, function_name)
+        )
+    return [TextContent(type="text", text=json.dumps(result, indent=2))]
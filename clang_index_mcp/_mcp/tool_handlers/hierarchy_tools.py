@@ -1,11 +1,13 @@
 """Class hierarchy MCP tool handlers."""
 
 import asyncio
+import json
 from typing import Any, Dict, List
 
 from mcp.types import TextContent
 
 from ..context import ctx
+from ..query_policy import _parse_search_scope
 from ..._search.hierarchy_format import convert_hierarchy_format, format_hierarchy_error
 
 
@@ -36,3 +38,48 @@ async def _handle_get_class_hierarchy(arguments: Dict[str, Any]) -> List[TextCon
     else:
         error_text = format_hierarchy_error(f"Class '{class_name}' not found", output_format)
         return [TextContent(type="text", text=error_text)]
+
+
+async def _handle_get_class_hierarchy_stats(arguments: Dict[str, Any]) -> List[TextContent]:
+    """Inheritance depth, fan-out and the widest base classes of the project."""
+    analyzer = ctx.analyzer
+    assert analyzer is not None
+    loop = asyncio.get_event_loop()
+    limit = max(1, min(int(arguments.get("max_results") or 10), 100))
+    project_only = _parse_search_scope(arguments)
+    # Run synchronous method in executor to avoid blocking event loop
+    with ctx.state_manager.tool_execution():
+        stats = await loop.run_in_executor(
+            None, lambda: analyzer.get_class_hierarchy_stats(limit, project_only)
+        )
+    return [TextContent(type="text", text=json.dumps(stats, indent=2))]
+
+
+async def _handle_find_overrides(arguments: Dict[str, Any]) -> List[TextContent]:
+    """Every override of a virtual method, with locations."""
+    analyzer = ctx.analyzer
+    assert analyzer is not None
+    loop = asyncio.get_event_loop()
+    function_name = str(arguments["function_name"])
+    class_name = str(arguments.get("class_name", ""))
+    project_only = _parse_search_scope(arguments)
+    # Run synchronous method in executor to avoid blocking event loop
+    with ctx.state_manager.tool_execution():
+        result = dict(
+            await loop.run_in_executor(
+                None, lambda: analyzer.find_overrides(function_name, class_name, project_only)
+            )
+        )
+    function_found = result.pop("_function_found", False)
+    if not function_found:
+        method = f"{class_name}::{function_name}" if class_name else function_name
+        return [TextContent(type="text", text=f"Error: Method '{method}' not found")]
+    if not result["overrides"]:
+        result["metadata"] = {
+            "suggestions": [
+                "No overrides are indexed. The method may not be virtual, or its overrides "
+                "may be in files that are not indexed (try "
+                "search_scope='include_external_libraries')."
+            ],
+        }
+    return [TextContent(type="text", text=json.dumps(result, indent=2))]
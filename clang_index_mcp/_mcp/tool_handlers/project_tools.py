@@ -264,6 +264,9 @@ async def _handle_check_system_status(arguments: Dict[str, Any]) -> List[TextCon
             "indexed_functions": total_functions,
         }
     )
+    query_cache = analyzer.context.query.query_cache
+    if query_cache is not None:
+        status_dict["query_cache"] = query_cache.get_stats()
     return [TextContent(type="text", text=json.dumps(status_dict, indent=2))]
 
 
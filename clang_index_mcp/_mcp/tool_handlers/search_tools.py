@@ -7,7 +7,7 @@ from typing import Any, Dict, List
 from mcp.types import TextContent
 
 from ..context import ctx
-from ..query_policy import _create_search_result
+from ..query_policy import _create_search_result, _parse_search_scope
 from ..response_formatters import suggestions
 from .execution_utils import execute_analyzer_search, execute_analyzer_query
 
@@ -68,6 +68,19 @@ async def _handle_get_class_info(arguments: Dict[str, Any]) -> List[TextContent]
     )
 
 
+async def _handle_get_class_info_batch(arguments: Dict[str, Any]) -> List[TextContent]:
+    analyzer = ctx.analyzer
+    assert analyzer is not None
+    class_names = [str(name) for name in arguments.get("class_names") or []]
+    if not class_names:
+        return [TextContent(type="text", text="Error: class_names must list at least one class")]
+    return await execute_analyzer_query(
+        arguments=arguments,
+        analyzer_method=lambda: analyzer.get_class_info_batch(class_names),
+        tool_name="get_class_info_batch",
+    )
+
+
 async def _handle_get_type_alias_info(arguments: Dict[str, Any]) -> List[TextContent]:
     analyzer = ctx.analyzer
     assert analyzer is not None
@@ -78,6 +91,19 @@ async def _handle_get_type_alias_info(arguments: Dict[str, Any]) -> List[TextCon
     )
 
 
+async def _handle_list_namespaces(arguments: Dict[str, Any]) -> List[TextContent]:
+    analyzer = ctx.analyzer
+    assert analyzer is not None
+    project_only = _parse_search_scope(arguments)
+    return await execute_analyzer_query(
+        arguments=arguments,
+        analyzer_method=lambda: analyzer.list_namespaces(
+            project_only, arguments.get("namespace", "")
+        ),
+        tool_name="list_namespaces",
+    )
+
+
 async def _handle_search_symbols(arguments: Dict[str, Any]) -> List[TextContent]:
     analyzer = ctx.analyzer
     assert analyzer is not None
@@ -378,6 +378,7 @@ class CacheOrchestrator:
             self.compilation_env.include_dependencies,
             validation_context=validation_context,
         )
+        self.call_graph_service.refresh_call_graph_snapshot()
 
     def load_cache(self) -> bool:
         """Load index from cache file"""
@@ -0,0 +1,57 @@
+-- Migration 004: Integer-keyed call_sites
+-- Store each USR once in the usr_ids dictionary table and make call_sites
+-- reference it by id instead of repeating caller/callee USR strings per row
+-- (and again in idx_call_sites_caller / idx_call_sites_callee).
+
+-- Legacy call_sites layout (for databases created before call sites existed)
+CREATE TABLE IF NOT EXISTS call_sites (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    caller_usr TEXT NOT NULL,
+    callee_usr TEXT NOT NULL,
+    file TEXT NOT NULL,
+    line INTEGER NOT NULL,
+    column INTEGER,
+    display_name TEXT,
+    template_project_types TEXT,
+    created_at REAL NOT NULL
+);
+
+CREATE TABLE IF NOT EXISTS usr_ids (
+    id INTEGER PRIMARY KEY,
+    usr TEXT NOT NULL UNIQUE
+);
+
+INSERT OR IGNORE INTO usr_ids (usr) SELECT caller_usr FROM call_sites;
+INSERT OR IGNORE INTO usr_ids (usr) SELECT callee_usr FROM call_sites;
+
+CREATE TABLE call_sites_new (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    caller_id INTEGER NOT NULL,
+    callee_id INTEGER NOT NULL,
+    file TEXT NOT NULL,
+    line INTEGER NOT NULL,
+    column INTEGER,
+    display_name TEXT,
+    template_project_types TEXT,
+    created_at REAL NOT NULL,
+    FOREIGN KEY (caller_id) REFERENCES usr_ids(id),
+    FOREIGN KEY (callee_id) REFERENCES usr_ids(id)
+);
+
+INSERT INTO call_sites_new (
+    id, caller_id, callee_id, file, line, column,
+    display_name, template_project_types, created_at
+)
+SELECT cs.id, caller.id, callee.id, cs.file, cs.line, cs.column,
+       cs.display_name, cs.template_project_types, cs.created_at
+FROM call_sites cs
+JOIN usr_ids caller ON caller.usr = cs.caller_usr
+JOIN usr_ids callee ON callee.usr = cs.callee_usr;
+
+DROP TABLE call_sites;
+ALTER TABLE call_sites_new RENAME TO call_sites;
+
+CREATE INDEX IF NOT EXISTS idx_call_sites_caller ON call_sites(caller_id);
+CREATE INDEX IF NOT EXISTS idx_call_sites_callee ON call_sites(callee_id);
+CREATE INDEX IF NOT EXISTS idx_call_sites_file ON call_sites(file);
+CREATE INDEX IF NOT EXISTS idx_call_sites_line ON call_sites(file, line);
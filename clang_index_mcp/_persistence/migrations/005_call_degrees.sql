@@ -0,0 +1,21 @@
+-- Migration 005: Per-function call degrees
+-- call_degrees counts the call sites into (in_degree) and out of (out_degree)
+-- every function, so hotspot queries need not aggregate call_sites.
+
+CREATE TABLE IF NOT EXISTS call_degrees (
+    usr_id INTEGER PRIMARY KEY,
+    in_degree INTEGER NOT NULL DEFAULT 0,
+    out_degree INTEGER NOT NULL DEFAULT 0,
+    FOREIGN KEY (usr_id) REFERENCES usr_ids(id)
+);
+
+INSERT OR REPLACE INTO call_degrees (usr_id, in_degree, out_degree)
+SELECT id, SUM(d_in), SUM(d_out) FROM (
+    SELECT callee_id AS id, 1 AS d_in, 0 AS d_out FROM call_sites
+    UNION ALL
+    SELECT caller_id, 0, 1 FROM call_sites
+)
+GROUP BY id;
+
+CREATE INDEX IF NOT EXISTS idx_call_degrees_in ON call_degrees(in_degree);
+CREATE INDEX IF NOT EXISTS idx_call_degrees_out ON call_degrees(out_degree);
@@ -0,0 +1,40 @@
+-- Migration 006: Template-mediated call sites by type
+-- Intern the project types recorded in call_sites.template_project_types
+-- (a JSON array) and link each call site to them, so call sites can be
+-- looked up by type through an index.
+
+CREATE TABLE IF NOT EXISTS template_type_names (
+    id INTEGER PRIMARY KEY,
+    name TEXT NOT NULL UNIQUE,
+    short_name TEXT NOT NULL
+);
+
+CREATE TABLE IF NOT EXISTS call_site_template_types (
+    type_id INTEGER NOT NULL,
+    call_site_id INTEGER NOT NULL,
+    PRIMARY KEY (type_id, call_site_id),
+    FOREIGN KEY (type_id) REFERENCES template_type_names(id),
+    FOREIGN KEY (call_site_id) REFERENCES call_sites(id)
+) WITHOUT ROWID;
+
+-- short_name: drop template arguments, then keep the text after the last "::"
+INSERT OR IGNORE INTO template_type_names (name, short_name)
+SELECT name, trim(substr(base, length(rtrim(base, replace(base, ':', ''))) + 1))
+FROM (
+    SELECT DISTINCT j.value AS name,
+           CASE WHEN instr(j.value, '<') > 0
+                THEN substr(j.value, 1, instr(j.value, '<') - 1)
+                ELSE j.value END AS base
+    FROM call_sites cs, json_each(cs.template_project_types) j
+    WHERE cs.template_project_types IS NOT NULL AND json_valid(cs.template_project_types)
+);
+
+INSERT OR IGNORE INTO call_site_template_types (type_id, call_site_id)
+SELECT t.id, cs.id
+FROM call_sites cs, json_each(cs.template_project_types) j
+JOIN template_type_names t ON t.name = j.value
+WHERE cs.template_project_types IS NOT NULL AND json_valid(cs.template_project_types);
+
+CREATE INDEX IF NOT EXISTS idx_template_type_names_short ON template_type_names(short_name);
+CREATE INDEX IF NOT EXISTS idx_call_site_template_types_site
+    ON call_site_template_types(call_site_id);
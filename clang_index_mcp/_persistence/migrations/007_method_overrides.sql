@@ -0,0 +1,16 @@
+-- Migration 007: Virtual method overrides
+-- Record which base class method each override overrides, so call graph
+-- queries can follow virtual dispatch without walking the class hierarchy.
+-- Overrides come from libclang at parse time; rows for existing caches
+-- appear as files are re-indexed.
+
+CREATE TABLE IF NOT EXISTS method_overrides (
+    override_id INTEGER NOT NULL,
+    overridden_id INTEGER NOT NULL,
+    PRIMARY KEY (override_id, overridden_id),
+    FOREIGN KEY (override_id) REFERENCES usr_ids(id),
+    FOREIGN KEY (overridden_id) REFERENCES usr_ids(id)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS idx_method_overrides_overridden
+    ON method_overrides(overridden_id);
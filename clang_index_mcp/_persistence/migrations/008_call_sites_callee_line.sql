@@ -0,0 +1,7 @@
+-- Migration 008: Call sites by callee in file/line order
+-- Extend the callee index with (file, line) so a page of the call sites into
+-- a function is read in order from the index and stops after the page.
+-- Queries by callee_id alone use its prefix, so the old index is dropped.
+
+CREATE INDEX IF NOT EXISTS idx_call_sites_callee_line ON call_sites(callee_id, file, line);
+DROP INDEX IF EXISTS idx_call_sites_callee;
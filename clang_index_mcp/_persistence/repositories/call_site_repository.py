@@ -1,8 +1,28 @@
-"""SQLite-backed call site storage and queries."""
+"""SQLite-backed call site storage and queries.
 
+call_sites stores caller/callee as integer ids into the usr_ids dictionary
+table; this repository maps USRs to ids and back so callers only see USRs.
+
+call_degrees keeps the number of call sites into (in_degree) and out of
+(out_degree) every function.  It is adjusted by deltas in the same
+transaction as every insert into and delete from call_sites, so
+project-wide hotspot queries read an index instead of aggregating
+call_sites.  The total row count is kept the same way in cache_metadata
+(call_site_count) for the call graph fingerprint.
+
+call_site_template_types links every template-mediated call site to the
+project types among its template arguments (interned in
+template_type_names), so "where is Sensor passed to make_shared" is an
+indexed lookup instead of a scan of the JSON template_project_types column.
+"""
+
+import json
 import sqlite3
 import time
-from typing import Any, Callable, Dict, List, Optional
+from collections import Counter
+from typing import Any, Callable, Dict, Iterable, List, Optional, Set, Tuple
+
+from ..._symbols.model import short_type_name
 
 try:
     from ..._core import diagnostics
@@ -10,6 +30,20 @@ except ImportError:
     import diagnostics  # type: ignore[no-redef]
 
 
+# USRs per IN (...) list, well below SQLite's host parameter limit
+_IN_BATCH = 500
+
+# Adds the inserted (in_degree, out_degree) deltas to an existing call_degrees row
+_DEGREE_UPSERT = """
+    ON CONFLICT(usr_id) DO UPDATE SET
+        in_degree = in_degree + excluded.in_degree,
+        out_degree = out_degree + excluded.out_degree
+"""
+
+# Function kinds reported as uncalled (dead code candidates)
+_UNCALLED_KINDS = ("function", "method")
+
+
 class CallSiteRepository:
     """Handles call site persistence: batch insert, query by caller/callee, delete."""
 
@@ -41,31 +75,74 @@ class CallSiteRepository:
                 )
                 for cs in call_sites
             ]
+            in_counts = Counter(cs["callee_usr"] for cs in call_sites)
+            out_counts = Counter(cs["caller_usr"] for cs in call_sites)
+            usrs = set(in_counts) | set(out_counts)
+            insert_sql = """
+                INSERT INTO call_sites (
+                    caller_id, callee_id, file, line, column,
+                    display_name, template_project_types, created_at
+                ) VALUES (
+                    (SELECT id FROM usr_ids WHERE usr = ?),
+                    (SELECT id FROM usr_ids WHERE usr = ?),
+                    ?, ?, ?, ?, ?, ?
+                )
+                """
             with self.conn:
                 self.conn.executemany(
-                    """
-                    INSERT INTO call_sites (
-                        caller_usr, callee_usr, file, line, column,
-                        display_name, template_project_types, created_at
-                    ) VALUES (?, ?, ?, ?, ?, ?, ?, ?)
+                    "INSERT OR IGNORE INTO usr_ids (usr) VALUES (?)", [(usr,) for usr in usrs]
+                )
+                self.conn.executemany(insert_sql, [row for row in values if not row[6]])
+                # Template-mediated call sites are rare; insert them one by one
+                # to link their row ids to the template types
+                for row in values:
+                    if row[6]:
+                        cursor = self.conn.execute(insert_sql, row)
+                        self._link_template_types(cursor.lastrowid, row[6])
+                self.conn.executemany(
+                    f"""
+                    INSERT INTO call_degrees (usr_id, in_degree, out_degree)
+                    SELECT id, ?, ? FROM usr_ids WHERE usr = ?
+                    {_DEGREE_UPSERT}
                     """,
-                    values,
+                    [(in_counts[usr], out_counts[usr], usr) for usr in usrs],
                 )
+                self._adjust_call_site_count(len(values))
             return len(call_sites)
         except Exception as e:
             diagnostics.error(f"Failed to batch save {len(call_sites)} call sites: {e}")
             return 0
 
+    def _link_template_types(self, call_site_id: Optional[int], template_types: str) -> None:
+        """Index a call site under each project type of its template arguments."""
+        try:
+            type_names = set(json.loads(template_types))
+        except (TypeError, ValueError):
+            return
+        for type_name in sorted(type_names):
+            self.conn.execute(
+                "INSERT OR IGNORE INTO template_type_names (name, short_name) VALUES (?, ?)",
+                (type_name, short_type_name(type_name)),
+            )
+            self.conn.execute(
+                """
+                INSERT OR IGNORE INTO call_site_template_types (type_id, call_site_id)
+                SELECT id, ? FROM template_type_names WHERE name = ?
+                """,
+                (call_site_id, type_name),
+            )
+
     def get_call_sites_for_caller(self, caller_usr: str) -> List[Dict[str, Any]]:
         """Get all call sites from a specific caller function."""
         try:
             cursor = self.conn.execute(
                 """
-                SELECT callee_usr, file, line, column,
-                       display_name, template_project_types
-                FROM call_sites
-                WHERE caller_usr = ?
-                ORDER BY file, line
+                SELECT callee.usr AS callee_usr, cs.file, cs.line, cs.column,
+                       cs.display_name, cs.template_project_types
+                FROM call_sites cs
+                JOIN usr_ids callee ON callee.id = cs.callee_id
+                WHERE cs.caller_id = (SELECT id FROM usr_ids WHERE usr = ?)
+                ORDER BY cs.file, cs.line
                 """,
                 (caller_usr,),
             )
@@ -89,11 +166,12 @@ class CallSiteRepository:
         try:
             cursor = self.conn.execute(
                 """
-                SELECT caller_usr, file, line, column,
-                       display_name, template_project_types
-                FROM call_sites
-                WHERE callee_usr = ?
-                ORDER BY file, line
+                SELECT caller.usr AS caller_usr, cs.file, cs.line, cs.column,
+                       cs.display_name, cs.template_project_types
+                FROM call_sites cs
+                JOIN usr_ids caller ON caller.id = cs.caller_id
+                WHERE cs.callee_id = (SELECT id FROM usr_ids WHERE usr = ?)
+                ORDER BY cs.file, cs.line
                 """,
                 (callee_usr,),
             )
@@ -112,42 +190,115 @@ class CallSiteRepository:
             diagnostics.error(f"Failed to get call sites for callee {callee_usr}: {e}")
             return []
 
-    def get_template_mediated_call_sites(
-        self, caller_usrs: List[str], callee_usr: str
-    ) -> List[Dict[str, Any]]:
-        """Get call sites between callers and callee that have template metadata."""
-        if not caller_usrs:
+    def get_call_sites_for_callers(self, caller_usrs: List[str]) -> List[Dict[str, Any]]:
+        """Get all call sites from any of caller_usrs, with caller and callee USRs."""
+        return self._get_call_sites_for_usrs(caller_usrs, "caller_id")
+
+    def get_call_sites_for_callees(self, callee_usrs: List[str]) -> List[Dict[str, Any]]:
+        """Get all call sites to any of callee_usrs, with caller and callee USRs."""
+        return self._get_call_sites_for_usrs(callee_usrs, "callee_id")
+
+    def _get_call_sites_for_usrs(self, usrs: List[str], column: str) -> List[Dict[str, Any]]:
+        """One IN (...) query per _IN_BATCH USRs, rows ordered by file and line."""
+        rows: List[Dict[str, Any]] = []
+        try:
+            for start in range(0, len(usrs), _IN_BATCH):
+                batch = usrs[start : start + _IN_BATCH]
+                placeholders = ",".join("?" for _ in batch)
+                cursor = self.conn.execute(
+                    f"""
+                    SELECT caller.usr AS caller_usr, callee.usr AS callee_usr,
+                           cs.file, cs.line, cs.column,
+                           cs.display_name, cs.template_project_types
+                    FROM call_sites cs
+                    JOIN usr_ids caller ON caller.id = cs.caller_id
+                    JOIN usr_ids callee ON callee.id = cs.callee_id
+                    WHERE cs.{column} IN (SELECT id FROM usr_ids WHERE usr IN ({placeholders}))
+                    """,
+                    batch,
+                )
+                rows.extend(dict(row) for row in cursor.fetchall())
+        except Exception as e:
+            diagnostics.error(f"Failed to get call sites for {len(usrs)} functions: {e}")
             return []
+        rows.sort(key=lambda row: (row["file"], row["line"]))
+        return rows
+
+    def get_call_sites_page_for_callee(
+        self, callee_usr: str, after: Optional[Tuple[str, int, str]], limit: int
+    ) -> List[Dict[str, Any]]:
+        """
+        One page of the call sites to callee_usr, keyset-paginated.
+
+        Returns up to limit rows with distinct (file, line, caller_usr), in that
+        order, starting at after (inclusive, None for the first page).  Calls
+        from one caller on one line (several calls, different columns) are one
+        call site, so only the first of their rows is kept.
+
+        idx_call_sites_callee_line delivers the rows in file/line order and the
+        cursor is read only until the page is full, so SQLite reads about limit
+        rows (plus same-line repeats) whatever the callee's total number of
+        call sites.
+        """
+        params: List[Any] = [callee_usr, callee_usr]
+        after_clause = ""
+        if after is not None:
+            after_clause = "AND (cs.file, cs.line, caller.usr) >= (?, ?, ?)"
+            params.extend(after)
+        rows: List[Dict[str, Any]] = []
         try:
-            placeholders = ",".join("?" for _ in caller_usrs)
             cursor = self.conn.execute(
                 f"""
-                SELECT caller_usr, callee_usr, file, line, column,
-                       display_name, template_project_types
-                FROM call_sites
-                WHERE caller_usr IN ({placeholders})
-                  AND callee_usr = ?
-                  AND template_project_types IS NOT NULL
-                ORDER BY file, line
+                SELECT caller.usr AS caller_usr, ? AS callee_usr,
+                       cs.file, cs.line, cs.column,
+                       cs.display_name, cs.template_project_types
+                FROM call_sites cs
+                JOIN usr_ids caller ON caller.id = cs.caller_id
+                WHERE cs.callee_id = (SELECT id FROM usr_ids WHERE usr = ?)
+                  {after_clause}
+                ORDER BY cs.file, cs.line, caller.usr
                 """,
-                (*caller_usrs, callee_usr),
+                params,
             )
-            return [
-                {
-                    "caller_usr": row["caller_usr"],
-                    "callee_usr": row["callee_usr"],
-                    "file": row["file"],
-                    "line": row["line"],
-                    "column": row["column"],
-                    "display_name": row["display_name"],
-                    "template_project_types": row["template_project_types"],
-                }
-                for row in cursor.fetchall()
-            ]
+            last = None
+            for row in cursor:
+                if len(rows) >= limit:
+                    break
+                key = (row["file"], row["line"], row["caller_usr"])
+                if key != last:
+                    rows.append(dict(row))
+                    last = key
+            cursor.close()
+            return rows
         except Exception as e:
-            diagnostics.error(
-                f"Failed to get template-mediated call sites for callee {callee_usr}: {e}"
+            diagnostics.error(f"Failed to get call site page for {callee_usr}: {e}")
+            return []
+
+    def get_call_sites_for_template_type(self, type_name: str) -> List[Dict[str, Any]]:
+        """Get template-mediated call sites with type_name among their project template types.
+
+        type_name matches the recorded type spelling ("app::Sensor") or its
+        unqualified name ("Sensor").
+        """
+        try:
+            cursor = self.conn.execute(
+                """
+                SELECT DISTINCT caller.usr AS caller_usr, callee.usr AS callee_usr,
+                       cs.file, cs.line, cs.column,
+                       cs.display_name, cs.template_project_types
+                FROM template_type_names t
+                JOIN call_site_template_types ct ON ct.type_id = t.id
+                JOIN call_sites cs ON cs.id = ct.call_site_id
+                JOIN usr_ids caller ON caller.id = cs.caller_id
+                JOIN usr_ids callee ON callee.id = cs.callee_id
+                WHERE t.name = ? OR t.short_name = ?
+                ORDER BY cs.file, cs.line
+                """,
+                (type_name, type_name),
             )
+            return [dict(row) for row in cursor.fetchall()]
+        except Exception as e:
+            diagnostics.error(f"Failed to get template call sites for type {type_name}: {e}")
             return []
 
     def delete_call_sites_by_file(self, file_path: str) -> int:
@@ -160,7 +311,7 @@ class CallSiteRepository:
             if count == 0:
                 return 0
             with self.conn:
-                self.conn.execute("DELETE FROM call_sites WHERE file = ?", (file_path,))
+                self._delete_call_sites("file = ?", (file_path,))
             return count
         except Exception as e:
             diagnostics.error(f"Failed to delete call sites for file {file_path}: {e}")
@@ -168,30 +319,98 @@ class CallSiteRepository:
 
     def delete_call_sites_by_usr(self, usr: str) -> int:
         """Delete all call sites where the given USR appears as either caller or callee."""
+        return self.delete_call_sites_by_usrs([usr])
+
+    def delete_call_sites_by_usrs(self, usrs: List[str]) -> int:
+        """Delete all call sites where any of usrs appears as caller or callee.
+
+        Runs one DELETE per _IN_BATCH USRs in a single transaction.
+        """
+        if not usrs:
+            return 0
         try:
-            cursor = self.conn.execute(
-                "SELECT COUNT(*) FROM call_sites WHERE caller_usr = ? OR callee_usr = ?",
-                (usr, usr),
-            )
-            count: int = cursor.fetchone()[0]
-            if count == 0:
-                return 0
+            deleted = 0
             with self.conn:
-                self.conn.execute(
-                    "DELETE FROM call_sites WHERE caller_usr = ? OR callee_usr = ?", (usr, usr)
-                )
-            return count
+                for start in range(0, len(usrs), _IN_BATCH):
+                    batch = usrs[start : start + _IN_BATCH]
+                    placeholders = ",".join("?" for _ in batch)
+                    where = (
+                        f"caller_id IN (SELECT id FROM usr_ids WHERE usr IN ({placeholders})) "
+                        f"OR callee_id IN (SELECT id FROM usr_ids WHERE usr IN ({placeholders}))"
+                    )
+                    deleted += self._delete_call_sites(where, (*batch, *batch))
+            return deleted
         except Exception as e:
-            diagnostics.error(f"Failed to delete call sites for USR {usr}: {e}")
+            diagnostics.error(f"Failed to delete call sites for {len(usrs)} USRs: {e}")
             return 0
 
+    def _delete_call_sites(self, where: str, params: Tuple[Any, ...]) -> int:
+        """Delete the call sites matching where with their degree counts and type links.
+
+        Must run inside a transaction; returns the number of deleted call sites.
+        """
+        self._subtract_call_degrees(where, params)
+        self.conn.execute(
+            f"""
+            DELETE FROM call_site_template_types
+            WHERE call_site_id IN (SELECT id FROM call_sites WHERE {where})
+            """,
+            params,
+        )
+        cursor = self.conn.execute(f"DELETE FROM call_sites WHERE {where}", params)
+        self._adjust_call_site_count(-cursor.rowcount)
+        return cursor.rowcount
+
+    def _adjust_call_site_count(self, delta: int) -> None:
+        """Add delta to call_site_count in cache_metadata (inside the caller's transaction)."""
+        if delta:
+            self.conn.execute(
+                """
+                UPDATE cache_metadata SET value = CAST(value AS INTEGER) + ?, updated_at = ?
+                WHERE key = 'call_site_count'
+                """,
+                (delta, time.time()),
+            )
+
+    def _subtract_call_degrees(self, where: str, params: Tuple[Any, ...]) -> None:
+        """Remove the call sites matching where from call_degrees; call before deleting them."""
+        self.conn.execute(
+            f"""
+            INSERT INTO call_degrees (usr_id, in_degree, out_degree)
+            SELECT id, SUM(d_in), SUM(d_out) FROM (
+                SELECT callee_id AS id, -1 AS d_in, 0 AS d_out FROM call_sites WHERE {where}
+                UNION ALL
+                SELECT caller_id, 0, -1 FROM call_sites WHERE {where}
+            )
+            WHERE true
+            GROUP BY id
+            {_DEGREE_UPSERT}
+            """,
+            (*params, *params),
+        )
+        # Functions left with no call sites either way lose their row
+        self.conn.execute(
+            f"""
+            DELETE FROM call_degrees
+            WHERE in_degree = 0 AND out_degree = 0 AND usr_id IN (
+                SELECT callee_id FROM call_sites WHERE {where}
+                UNION
+                SELECT caller_id FROM call_sites WHERE {where}
+            )
+            """,
+            (*params, *params),
+        )
+
     def load_all_call_sites(self) -> List[Dict[str, Any]]:
         """Load all call sites from the database."""
         try:
             cursor = self.conn.execute("""
-                SELECT caller_usr, callee_usr, file, line, column
-                FROM call_sites
-                ORDER BY file, line
+                SELECT caller.usr AS caller_usr, callee.usr AS callee_usr,
+                       cs.file, cs.line, cs.column
+                FROM call_sites cs
+                JOIN usr_ids caller ON caller.id = cs.caller_id
+                JOIN usr_ids callee ON callee.id = cs.callee_id
+                ORDER BY cs.file, cs.line
                 """)
             return [
                 {
@@ -206,3 +425,240 @@ class CallSiteRepository:
         except Exception as e:
             diagnostics.error(f"Failed to load call sites from database: {e}")
             return []
+
+    def get_call_graph_fingerprint(self) -> Optional[Tuple[int, int, int]]:
+        """Return (database id, row count, max row id) of call_sites.
+
+        Row ids are never reused (AUTOINCREMENT), so any insert or delete
+        changes the fingerprint.  The AUTOINCREMENT sequence restarts when
+        the database is recreated, hence the database id.  The row count is
+        read from cache_metadata rather than counted.
+        """
+        try:
+            metadata = dict(
+                self.conn.execute(
+                    """
+                    SELECT key, value FROM cache_metadata
+                    WHERE key IN ('database_id', 'call_site_count')
+                    """
+                ).fetchall()
+            )
+            if len(metadata) < 2:
+                metadata = self._init_fingerprint_metadata()
+            row = self.conn.execute("SELECT COALESCE(MAX(id), 0) FROM call_sites").fetchone()
+            return int(metadata["database_id"], 16), int(metadata["call_site_count"]), int(row[0])
+        except Exception as e:
+            diagnostics.error(f"Failed to read call graph fingerprint: {e}")
+            return None
+
+    def _init_fingerprint_metadata(self) -> Dict[str, str]:
+        """Add the fingerprint keys to a database created without them (counts rows once)."""
+        with self.conn:
+            self.conn.execute(
+                """
+                INSERT OR IGNORE INTO cache_metadata (key, value, updated_at)
+                VALUES ('database_id', lower(hex(randomblob(7))), ?)
+                """,
+                (time.time(),),
+            )
+            self.conn.execute(
+                """
+                INSERT OR IGNORE INTO cache_metadata (key, value, updated_at)
+                SELECT 'call_site_count', COUNT(*), ? FROM call_sites
+                """,
+                (time.time(),),
+            )
+        return dict(
+            self.conn.execute(
+                """
+                SELECT key, value FROM cache_metadata
+                WHERE key IN ('database_id', 'call_site_count')
+                """
+            ).fetchall()
+        )
+
+    def load_call_edges(self) -> Tuple[List[Tuple[int, str]], List[Tuple[int, int]]]:
+        """Load distinct (caller_id, callee_id) edges and the (id, usr) rows they use."""
+        try:
+            usr_rows = self.conn.execute("""
+                SELECT id, usr FROM usr_ids
+                WHERE id IN (
+                    SELECT caller_id FROM call_sites UNION SELECT callee_id FROM call_sites
+                )
+                """).fetchall()
+            edges = self.conn.execute(
+                "SELECT DISTINCT caller_id, callee_id FROM call_sites"
+            ).fetchall()
+            return [(row[0], row[1]) for row in usr_rows], [(row[0], row[1]) for row in edges]
+        except Exception as e:
+            diagnostics.error(f"Failed to load call graph edges: {e}")
+            return [], []
+
+    def get_reachable_usrs(
+        self, start_usrs: List[str], max_depth: int, reverse: bool, limit: int
+    ) -> Optional[List[Tuple[str, int]]]:
+        """Return (usr, call distance) of functions within max_depth calls of start_usrs.
+
+        Follows callees (callers if reverse) level by level over the integer
+        call_sites columns, expanding every function once at its shortest
+        distance.  Start nodes are excluded; rows are ordered by distance and
+        the walk stops as soon as limit functions were reached.
+        """
+        if not start_usrs:
+            return []
+        near, far = ("callee_id", "caller_id") if reverse else ("caller_id", "callee_id")
+        try:
+            frontier = self._ids_of_usrs(start_usrs)
+            seen = set(frontier)
+            result: List[Tuple[str, int]] = []
+            for depth in range(1, max_depth + 1):
+                if not frontier or len(result) >= limit:
+                    break
+                found: Set[int] = set()
+                for start in range(0, len(frontier), _IN_BATCH):
+                    batch = frontier[start : start + _IN_BATCH]
+                    placeholders = ",".join("?" for _ in batch)
+                    cursor = self.conn.execute(
+                        f"SELECT DISTINCT {far} FROM call_sites WHERE {near} IN ({placeholders})",
+                        batch,
+                    )
+                    found.update(row[0] for row in cursor if row[0] not in seen)
+                seen |= found
+                frontier = list(found)
+                usrs = sorted(self._usrs_of_ids(frontier))
+                result.extend((usr, depth) for usr in usrs[: limit - len(result)])
+            return result
+        except Exception as e:
+            diagnostics.error(f"Failed to query reachable functions: {e}")
+            return None
+
+    def _ids_of_usrs(self, usrs: List[str]) -> List[int]:
+        ids: List[int] = []
+        for start in range(0, len(usrs), _IN_BATCH):
+            batch = usrs[start : start + _IN_BATCH]
+            placeholders = ",".join("?" for _ in batch)
+            cursor = self.conn.execute(
+                f"SELECT id FROM usr_ids WHERE usr IN ({placeholders})", batch
+            )
+            ids.extend(row[0] for row in cursor)
+        return ids
+
+    def _usrs_of_ids(self, ids: List[int]) -> List[str]:
+        usrs: List[str] = []
+        for start in range(0, len(ids), _IN_BATCH):
+            batch = ids[start : start + _IN_BATCH]
+            placeholders = ",".join("?" for _ in batch)
+            cursor = self.conn.execute(
+                f"SELECT usr FROM usr_ids WHERE id IN ({placeholders})", batch
+            )
+            usrs.extend(row[0] for row in cursor)
+        return usrs
+
+    def get_top_call_degrees(
+        self, column: str, limit: int, project_only: bool = False
+    ) -> List[Tuple[str, int, int]]:
+        """Return (usr, in_degree, out_degree) of the limit functions with the largest column.
+
+        column is "in_degree" (most called) or "out_degree" (most calls made).
+        Reads idx_call_degrees_in / idx_call_degrees_out from the top, so the
+        cost grows with limit rather than with the size of the call graph.
+        With project_only, only functions indexed as project symbols count.
+        """
+        if column not in ("in_degree", "out_degree"):
+            raise ValueError(f"Unknown call degree column: {column}")
+        project_filter = (
+            "AND EXISTS (SELECT 1 FROM symbols s WHERE s.usr = u.usr AND s.is_project = 1)"
+            if project_only
+            else ""
+        )
+        try:
+            cursor = self.conn.execute(
+                f"""
+                SELECT u.usr, d.in_degree, d.out_degree
+                FROM call_degrees d
+                JOIN usr_ids u ON u.id = d.usr_id
+                WHERE d.{column} > 0 {project_filter}
+                ORDER BY d.{column} DESC, u.usr
+                LIMIT ?
+                """,
+                (limit,),
+            )
+            return [(row[0], row[1], row[2]) for row in cursor.fetchall()]
+        except Exception as e:
+            diagnostics.error(f"Failed to query call degrees: {e}")
+            return []
+
+    def get_call_degrees(self, usrs: Iterable[str]) -> Dict[str, Tuple[int, int]]:
+        """Return {usr: (in_degree, out_degree)} for those of usrs that have call sites."""
+        usr_list = list(usrs)
+        degrees: Dict[str, Tuple[int, int]] = {}
+        try:
+            for start in range(0, len(usr_list), _IN_BATCH):
+                batch = usr_list[start : start + _IN_BATCH]
+                placeholders = ",".join("?" for _ in batch)
+                cursor = self.conn.execute(
+                    f"""
+                    SELECT u.usr, d.in_degree, d.out_degree
+                    FROM usr_ids u
+                    JOIN call_degrees d ON d.usr_id = u.id
+                    WHERE u.usr IN ({placeholders})
+                    """,
+                    batch,
+                )
+                for row in cursor.fetchall():
+                    degrees[row[0]] = (row[1], row[2])
+        except Exception as e:
+            diagnostics.error(f"Failed to load call degrees for {len(usr_list)} functions: {e}")
+            return {}
+        return degrees
+
+    def get_call_degree_totals(self) -> Dict[str, int]:
+        """Return functions making calls, functions being called and the total call sites."""
+        try:
+            row = self.conn.execute("""
+                SELECT COALESCE(SUM(out_degree > 0), 0),
+                       COALESCE(SUM(in_degree > 0), 0),
+                       COALESCE(SUM(in_degree), 0)
+                FROM call_degrees
+                """).fetchone()
+            return {
+                "functions_with_calls": int(row[0]),
+                "functions_being_called": int(row[1]),
+                "call_sites": int(row[2]),
+            }
+        except Exception as e:
+            diagnostics.error(f"Failed to read call degree totals: {e}")
+            return {"functions_with_calls": 0, "functions_being_called": 0, "call_sites": 0}
+
+    def get_uncalled_functions(self, limit: int) -> List[str]:
+        """Return USRs of project function definitions that no indexed call site reaches.
+
+        These are dead code candidates: virtual methods (reachable through
+        dispatch), constructors, destructors, operators and main are left out.
+        """
+        kinds = ",".join("?" for _ in _UNCALLED_KINDS)
+        try:
+            cursor = self.conn.execute(
+                f"""
+                SELECT s.usr
+                FROM symbols s
+                LEFT JOIN usr_ids u ON u.usr = s.usr
+                LEFT JOIN call_degrees d ON d.usr_id = u.id
+                WHERE s.kind IN ({kinds})
+                  AND s.is_project = 1
+                  AND s.is_definition = 1
+                  AND s.is_virtual = 0
+                  AND COALESCE(d.in_degree, 0) = 0
+                  AND s.name != 'main'
+                  AND s.name != s.parent_class
+                  AND s.name NOT LIKE '~%'
+                  AND s.name NOT LIKE 'operator%'
+                ORDER BY s.file, s.line
+                LIMIT ?
+                """,
+                (*_UNCALLED_KINDS, limit),
+            )
+            return [row[0] for row in cursor.fetchall()]
+        except Exception as e:
+            diagnostics.error(f"Failed to query uncalled functions: {e}")
+            return []
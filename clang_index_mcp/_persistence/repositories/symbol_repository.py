@@ -3,7 +3,7 @@
 import json
 import sqlite3
 import time
-from typing import Callable, List, Optional
+from typing import Callable, Dict, List, Optional, Set, Tuple
 
 from ..._symbols.model import SymbolInfo
 
@@ -12,6 +12,9 @@ try:
 except ImportError:
     import diagnostics  # type: ignore[no-redef]
 
+# USRs per IN (...) list, well below SQLite's host parameter limit
+_IN_BATCH = 500
+
 
 class SymbolRepository:
     """Handles symbol persistence: insert, batch write, search, and delete."""
@@ -71,10 +74,18 @@ class SymbolRepository:
         )
 
     def row_to_symbol(self, row: sqlite3.Row) -> SymbolInfo:
-        """Convert database row to SymbolInfo object."""
+        """Convert database row to SymbolInfo object.
+
+        base_classes and template_parameters stay JSON columns rather than
+        child tables: nothing queries them in SQL, and one json.loads per row
+        is cheaper than joining and regrouping child rows in Python.
+        """
+        # Column names once per row; rows from older layouts lack some columns
+        columns = set(row.keys())
+        base_classes = row["base_classes"]
         return SymbolInfo(
             name=row["name"],
-            qualified_name=(row["qualified_name"] if "qualified_name" in row.keys() else ""),
+            qualified_name=row["qualified_name"] if "qualified_name" in columns else "",
             kind=row["kind"],
             file=row["file"],
             line=row["line"],
@@ -84,38 +95,40 @@ class SymbolRepository:
             namespace=row["namespace"] or "",
             access=row["access"] or "public",
             parent_class=row["parent_class"] or "",
-            base_classes=json.loads(row["base_classes"]) if row["base_classes"] else [],
+            base_classes=(
+                json.loads(base_classes) if base_classes and base_classes != "[]" else []
+            ),
             usr=row["usr"] or "",
             is_template_specialization=(
                 bool(row["is_template_specialization"])
-                if "is_template_specialization" in row.keys()
+                if "is_template_specialization" in columns
                 else False
             ),
-            is_template=(bool(row["is_template"]) if "is_template" in row.keys() else False),
-            template_kind=(row["template_kind"] if "template_kind" in row.keys() else None),
+            is_template=(bool(row["is_template"]) if "is_template" in columns else False),
+            template_kind=(row["template_kind"] if "template_kind" in columns else None),
             template_parameters=(
-                row["template_parameters"] if "template_parameters" in row.keys() else None
+                row["template_parameters"] if "template_parameters" in columns else None
             ),
             primary_template_usr=(
-                row["primary_template_usr"] if "primary_template_usr" in row.keys() else None
+                row["primary_template_usr"] if "primary_template_usr" in columns else None
             ),
-            start_line=row["start_line"] if "start_line" in row.keys() else None,
-            end_line=row["end_line"] if "end_line" in row.keys() else None,
-            header_file=row["header_file"] if "header_file" in row.keys() else None,
-            header_line=row["header_line"] if "header_line" in row.keys() else None,
+            start_line=row["start_line"] if "start_line" in columns else None,
+            end_line=row["end_line"] if "end_line" in columns else None,
+            header_file=row["header_file"] if "header_file" in columns else None,
+            header_line=row["header_line"] if "header_line" in columns else None,
             header_start_line=(
-                row["header_start_line"] if "header_start_line" in row.keys() else None
+                row["header_start_line"] if "header_start_line" in columns else None
             ),
-            header_end_line=row["header_end_line"] if "header_end_line" in row.keys() else None,
-            is_definition=bool(row["is_definition"]) if "is_definition" in row.keys() else False,
-            is_virtual=bool(row["is_virtual"]) if "is_virtual" in row.keys() else False,
+            header_end_line=row["header_end_line"] if "header_end_line" in columns else None,
+            is_definition=bool(row["is_definition"]) if "is_definition" in columns else False,
+            is_virtual=bool(row["is_virtual"]) if "is_virtual" in columns else False,
             is_pure_virtual=(
-                bool(row["is_pure_virtual"]) if "is_pure_virtual" in row.keys() else False
+                bool(row["is_pure_virtual"]) if "is_pure_virtual" in columns else False
             ),
-            is_const=bool(row["is_const"]) if "is_const" in row.keys() else False,
-            is_static=bool(row["is_static"]) if "is_static" in row.keys() else False,
-            brief=row["brief"] if "brief" in row.keys() else None,
-            doc_comment=row["doc_comment"] if "doc_comment" in row.keys() else None,
+            is_const=bool(row["is_const"]) if "is_const" in columns else False,
+            is_static=bool(row["is_static"]) if "is_static" in columns else False,
+            brief=row["brief"] if "brief" in columns else None,
+            doc_comment=row["doc_comment"] if "doc_comment" in columns else None,
         )
 
     def save_symbol(self, symbol: SymbolInfo) -> bool:
@@ -138,6 +151,7 @@ class SymbolRepository:
                     """,
                     self.symbol_to_tuple(symbol),
                 )
+                self._save_overrides([symbol])
             return True
         except Exception as e:
             diagnostics.error(f"Failed to save symbol {symbol.usr}: {e}")
@@ -165,11 +179,97 @@ class SymbolRepository:
                     """,
                     [self.symbol_to_tuple(s) for s in symbols],
                 )
+                self._save_overrides(symbols)
             return len(symbols)
         except Exception as e:
             diagnostics.error(f"Failed to batch save {len(symbols)} symbols: {e}")
             return 0
 
+    def _save_overrides(self, symbols: List[SymbolInfo]) -> None:
+        """Record the base methods overridden by virtual methods in method_overrides.
+
+        Symbols loaded back from SQLite carry no overridden_usrs; re-saving them
+        leaves the recorded overrides alone.  Runs inside the caller's transaction.
+        """
+        pairs = [(s.usr, base) for s in symbols if s.usr for base in s.overridden_usrs]
+        if not pairs:
+            return
+        usrs = {usr for pair in pairs for usr in pair}
+        self.conn.executemany(
+            "INSERT OR IGNORE INTO usr_ids (usr) VALUES (?)", [(usr,) for usr in usrs]
+        )
+        self.conn.executemany(
+            """
+            INSERT OR IGNORE INTO method_overrides (override_id, overridden_id)
+            SELECT o.id, b.id FROM usr_ids o, usr_ids b WHERE o.usr = ? AND b.usr = ?
+            """,
+            pairs,
+        )
+
+    def get_overridden_methods(self, usrs: List[str]) -> Set[str]:
+        """USRs of every base method the given methods override, transitively.
+
+        One recursive query per batch walks method_overrides upwards; the
+        given USRs themselves are not included.
+        """
+        overridden: Set[str] = set()
+        try:
+            for start in range(0, len(usrs), _IN_BATCH):
+                batch = usrs[start : start + _IN_BATCH]
+                placeholders = ",".join("?" for _ in batch)
+                cursor = self.conn.execute(
+                    f"""
+                    WITH RECURSIVE bases(id) AS (
+                        SELECT o.overridden_id FROM method_overrides o
+                        JOIN usr_ids u ON u.id = o.override_id
+                        WHERE u.usr IN ({placeholders})
+                        UNION
+                        SELECT o.overridden_id FROM method_overrides o
+                        JOIN bases b ON o.override_id = b.id
+                    )
+                    SELECT u.usr FROM bases JOIN usr_ids u ON u.id = bases.id
+                    """,
+                    batch,
+                )
+                overridden.update(row[0] for row in cursor.fetchall())
+        except Exception as e:
+            diagnostics.error(f"Failed to load overridden methods: {e}")
+        return overridden - set(usrs)
+
+    def get_overriding_methods(self, usrs: List[str]) -> List[Tuple[str, str]]:
+        """Every method overriding the given methods, transitively.
+
+        Walks method_overrides downwards through idx_method_overrides_overridden,
+        one recursive query per batch.  Returns (override USR, USR of the method
+        it directly overrides) pairs; an override of several bases appears once
+        per base.
+        """
+        edges: Set[Tuple[str, str]] = set()
+        try:
+            for start in range(0, len(usrs), _IN_BATCH):
+                batch = usrs[start : start + _IN_BATCH]
+                placeholders = ",".join("?" for _ in batch)
+                cursor = self.conn.execute(
+                    f"""
+                    WITH RECURSIVE overrides(id, base_id) AS (
+                        SELECT o.override_id, o.overridden_id FROM method_overrides o
+                        JOIN usr_ids u ON u.id = o.overridden_id
+                        WHERE u.usr IN ({placeholders})
+                        UNION
+                        SELECT o.override_id, o.overridden_id FROM method_overrides o
+                        JOIN overrides r ON o.overridden_id = r.id
+                    )
+                    SELECT d.usr, b.usr FROM overrides r
+                    JOIN usr_ids d ON d.id = r.id
+                    JOIN usr_ids b ON b.id = r.base_id
+                    """,
+                    batch,
+                )
+                edges.update((row[0], row[1]) for row in cursor.fetchall())
+        except Exception as e:
+            diagnostics.error(f"Failed to load overriding methods: {e}")
+        return sorted(edges)
+
     def load_symbol_by_usr(self, usr: str) -> Optional[SymbolInfo]:
         """Load a symbol by its USR."""
         try:
@@ -182,6 +282,23 @@ class SymbolRepository:
             diagnostics.error(f"Failed to load symbol by USR {usr}: {e}")
             return None
 
+    def load_symbols_by_usrs(self, usrs: List[str]) -> Dict[str, SymbolInfo]:
+        """Load the symbols with the given USRs (one IN (...) query per batch)."""
+        symbols: Dict[str, SymbolInfo] = {}
+        try:
+            for start in range(0, len(usrs), _IN_BATCH):
+                batch = usrs[start : start + _IN_BATCH]
+                placeholders = ",".join("?" for _ in batch)
+                cursor = self.conn.execute(
+                    f"SELECT * FROM symbols WHERE usr IN ({placeholders})", batch
+                )
+                for row in cursor.fetchall():
+                    symbol = self.row_to_symbol(row)
+                    symbols[symbol.usr] = symbol
+        except Exception as e:
+            diagnostics.error(f"Failed to load {len(usrs)} symbols by USR: {e}")
+        return symbols
+
     def load_symbols_by_name(self, name: str) -> List[SymbolInfo]:
         """Load all symbols matching a name."""
         try:
@@ -209,6 +326,15 @@ class SymbolRepository:
             if count == 0:
                 return 0
             with self.conn:
+                self.conn.execute(
+                    """
+                    DELETE FROM method_overrides WHERE override_id IN (
+                        SELECT u.id FROM symbols s JOIN usr_ids u ON u.usr = s.usr
+                        WHERE s.file = ?
+                    )
+                    """,
+                    (file_path,),
+                )
                 self.conn.execute("DELETE FROM symbols WHERE file = ?", (file_path,))
             diagnostics.debug(f"Deleted {count} symbols from {file_path}")
             return count
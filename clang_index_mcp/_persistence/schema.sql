@@ -1,6 +1,11 @@
 -- SQLite Schema for C++ Symbol Cache
--- Version: 17.0
+-- Version: 22.0
 -- Optimized for fast symbol lookups with FTS5 full-text search
+-- Changelog v22.0: idx_call_sites_callee covers (callee_id, file, line) for keyset-paginated call sites
+-- Changelog v21.0: method_overrides table (override -> overridden method) for virtual dispatch in the call graph
+-- Changelog v20.0: call_site_template_types join table indexing template-mediated call sites by project type
+-- Changelog v19.0: call_degrees table with per-function call site counts (call graph hotspots)
+-- Changelog v18.0: call_sites references USRs through the usr_ids dictionary table (integer caller_id/callee_id)
 -- Changelog v17.0: Template-mediated call tracking (display_name, template_project_types columns in call_sites)
 -- Changelog v16.0: Human-readable function signatures (forces re-index to regenerate cached signatures)
 -- Changelog v15.0: Fixed type_aliases unique constraint to allow multiple macro-generated aliases at same location
@@ -54,6 +59,9 @@ CREATE TABLE IF NOT EXISTS symbols (
     access TEXT DEFAULT 'public',      -- "public", "private", "protected"
     parent_class TEXT DEFAULT '',      -- For methods: containing class name
     base_classes TEXT DEFAULT '[]',    -- JSON array of base class names
+    -- base_classes/template_parameters are only read back whole into SymbolInfo
+    -- (the in-memory inheritance index answers base-class lookups), so they are
+    -- not normalized into child tables
     -- Note: calls/called_by columns removed in v9.0 (Task 1.2 memory optimization)
     -- Call graph data is now stored in call_sites table
 
@@ -162,10 +170,14 @@ CREATE TABLE IF NOT EXISTS cache_metadata (
 
 -- Initial metadata
 INSERT OR IGNORE INTO cache_metadata (key, value, updated_at) VALUES
-    ('version', '"17.0"', julianday('now')),
+    ('version', '"22.0"', julianday('now')),
     ('include_dependencies', 'false', julianday('now')),
     ('indexed_file_count', '0', julianday('now')),
-    ('last_vacuum', '0', julianday('now'));
+    ('last_vacuum', '0', julianday('now')),
+    -- Drawn once per database; part of the call graph snapshot fingerprint
+    ('database_id', lower(hex(randomblob(7))), julianday('now')),
+    -- Rows in call_sites, adjusted with every insert/delete
+    ('call_site_count', '0', julianday('now'));
 
 -- Header tracking table (replaces header_tracker.json)
 CREATE TABLE IF NOT EXISTS header_tracker (
@@ -214,28 +226,86 @@ CREATE INDEX IF NOT EXISTS idx_dep_detected ON file_dependencies(detected_at);
 
 -- Phase 3: Call Graph Enhancement Tables (v8.0)
 
+-- USR dictionary (v18.0): each USR string is stored once; call_sites refers to it by id.
+-- Rows are never deleted, so ids stay stable for the lifetime of the database.
+CREATE TABLE IF NOT EXISTS usr_ids (
+    id INTEGER PRIMARY KEY,
+    usr TEXT NOT NULL UNIQUE
+);
+
 -- Call sites table: Tracks exact line/column where function calls occur
 -- Enables line-level precision for call graph analysis
 CREATE TABLE IF NOT EXISTS call_sites (
     id INTEGER PRIMARY KEY AUTOINCREMENT,
-    caller_usr TEXT NOT NULL,              -- USR of calling function
-    callee_usr TEXT NOT NULL,              -- USR of called function
+    caller_id INTEGER NOT NULL,            -- usr_ids.id of calling function
+    callee_id INTEGER NOT NULL,            -- usr_ids.id of called function
     file TEXT NOT NULL,                    -- Source file containing call
     line INTEGER NOT NULL,                 -- Line number of call
     column INTEGER,                        -- Column number (optional)
     display_name TEXT,                     -- Specialized display name (e.g. "std::make_shared<Sensor>")
     template_project_types TEXT,           -- JSON array of project types in template args (e.g. '["Sensor"]')
     created_at REAL NOT NULL,              -- When call site was indexed
-    FOREIGN KEY (caller_usr) REFERENCES symbols(usr) ON DELETE CASCADE,
-    FOREIGN KEY (callee_usr) REFERENCES symbols(usr) ON DELETE CASCADE
+    FOREIGN KEY (caller_id) REFERENCES usr_ids(id),
+    FOREIGN KEY (callee_id) REFERENCES usr_ids(id)
 );
 
 -- Indexes for fast call site queries
-CREATE INDEX IF NOT EXISTS idx_call_sites_caller ON call_sites(caller_usr);
-CREATE INDEX IF NOT EXISTS idx_call_sites_callee ON call_sites(callee_usr);
+CREATE INDEX IF NOT EXISTS idx_call_sites_caller ON call_sites(caller_id);
+-- (callee_id, file, line): the call sites into a function in file/line order,
+-- so a page of them is read straight from the index (v22.0)
+CREATE INDEX IF NOT EXISTS idx_call_sites_callee_line ON call_sites(callee_id, file, line);
 CREATE INDEX IF NOT EXISTS idx_call_sites_file ON call_sites(file);
 CREATE INDEX IF NOT EXISTS idx_call_sites_line ON call_sites(file, line);
 
+-- Call degrees (v19.0): call sites into and out of each function.
+-- Maintained by delta counts together with every call_sites insert/delete,
+-- so hotspot queries (most called, most calls made) read an index top-down.
+CREATE TABLE IF NOT EXISTS call_degrees (
+    usr_id INTEGER PRIMARY KEY,            -- usr_ids.id of the function
+    in_degree INTEGER NOT NULL DEFAULT 0,  -- Call sites calling the function
+    out_degree INTEGER NOT NULL DEFAULT 0, -- Call sites inside the function
+    FOREIGN KEY (usr_id) REFERENCES usr_ids(id)
+);
+
+CREATE INDEX IF NOT EXISTS idx_call_degrees_in ON call_degrees(in_degree);
+CREATE INDEX IF NOT EXISTS idx_call_degrees_out ON call_degrees(out_degree);
+
+-- Template-mediated call sites by type (v20.0): the project types of
+-- template_project_types, interned once and linked to each call site, so a
+-- lookup by type ("where is Sensor passed to make_shared") uses an index.
+CREATE TABLE IF NOT EXISTS template_type_names (
+    id INTEGER PRIMARY KEY,
+    name TEXT NOT NULL UNIQUE,             -- Type spelling as recorded (e.g. "app::Sensor")
+    short_name TEXT NOT NULL               -- Unqualified name (e.g. "Sensor")
+);
+
+CREATE INDEX IF NOT EXISTS idx_template_type_names_short ON template_type_names(short_name);
+
+CREATE TABLE IF NOT EXISTS call_site_template_types (
+    type_id INTEGER NOT NULL,              -- template_type_names.id
+    call_site_id INTEGER NOT NULL,         -- call_sites.id
+    PRIMARY KEY (type_id, call_site_id),
+    FOREIGN KEY (type_id) REFERENCES template_type_names(id),
+    FOREIGN KEY (call_site_id) REFERENCES call_sites(id)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS idx_call_site_template_types_site
+    ON call_site_template_types(call_site_id);
+
+-- Method overrides (v21.0): each virtual method override and the base method
+-- it overrides, as reported by libclang at index time.  Call graph queries
+-- follow it to surface calls dispatched through a base class virtual.
+CREATE TABLE IF NOT EXISTS method_overrides (
+    override_id INTEGER NOT NULL,          -- usr_ids.id of the overriding method
+    overridden_id INTEGER NOT NULL,        -- usr_ids.id of the overridden base method
+    PRIMARY KEY (override_id, overridden_id),
+    FOREIGN KEY (override_id) REFERENCES usr_ids(id),
+    FOREIGN KEY (overridden_id) REFERENCES usr_ids(id)
+) WITHOUT ROWID;
+
+CREATE INDEX IF NOT EXISTS idx_method_overrides_overridden
+    ON method_overrides(overridden_id);
+
 -- Phase 1: Type Alias Tracking (v11.0, Issue #84)
 
 -- Type aliases table: Tracks using/typedef declarations
@@ -27,7 +27,7 @@ class SchemaMigration:
             migration.migrate()
     """
 
-    CURRENT_VERSION = 3  # Updated for file_metadata failure tracking
+    CURRENT_VERSION = 8  # Updated for idx_call_sites_callee_line
 
     def __init__(self, conn: sqlite3.Connection):
         """
@@ -6,7 +6,7 @@ import sqlite3
 import sys
 import time
 from pathlib import Path
-from typing import Any, Dict, List, Optional, Set, Tuple
+from typing import Any, Dict, Iterable, List, Optional, Set, Tuple
 
 from .._symbols.model import SymbolInfo
 from .._symbols.ports.parser import TypeAliasRecord
@@ -45,7 +45,7 @@ class SqliteCacheBackend:
     complexity, since the cache can be regenerated from source files.
     """
 
-    CURRENT_SCHEMA_VERSION = "17.0"  # Must match version in schema.sql
+    CURRENT_SCHEMA_VERSION = "22.0"  # Must match version in schema.sql
 
     def __init__(self, db_path: Path, skip_schema_recreation: bool = False):
         """
@@ -471,6 +471,18 @@ class SqliteCacheBackend:
         self._ensure_connected()
         return self._symbol_repo.load_symbol_by_usr(usr)
 
+    def load_symbols_by_usrs(self, usrs: List[str]) -> Dict[str, SymbolInfo]:
+        self._ensure_connected()
+        return self._symbol_repo.load_symbols_by_usrs(usrs)
+
+    def get_overridden_methods(self, usrs: List[str]) -> Set[str]:
+        self._ensure_connected()
+        return self._symbol_repo.get_overridden_methods(usrs)
+
+    def get_overriding_methods(self, usrs: List[str]) -> List[Tuple[str, str]]:
+        self._ensure_connected()
+        return self._symbol_repo.get_overriding_methods(usrs)
+
     def load_symbols_by_name(self, name: str) -> List[SymbolInfo]:
         self._ensure_connected()
         return self._symbol_repo.load_symbols_by_name(name)
@@ -962,11 +974,23 @@ class SqliteCacheBackend:
         self._ensure_connected()
         return self._call_site_repo.get_call_sites_for_callee(callee_usr)
 
-    def get_template_mediated_call_sites(
-        self, caller_usrs: List[str], callee_usr: str
+    def get_call_sites_for_callers(self, caller_usrs: List[str]) -> List[Dict[str, Any]]:
+        self._ensure_connected()
+        return self._call_site_repo.get_call_sites_for_callers(caller_usrs)
+
+    def get_call_sites_for_callees(self, callee_usrs: List[str]) -> List[Dict[str, Any]]:
+        self._ensure_connected()
+        return self._call_site_repo.get_call_sites_for_callees(callee_usrs)
+
+    def get_call_sites_page_for_callee(
+        self, callee_usr: str, after: Optional[Tuple[str, int, str]], limit: int
     ) -> List[Dict[str, Any]]:
         self._ensure_connected()
-        return self._call_site_repo.get_template_mediated_call_sites(caller_usrs, callee_usr)
+        return self._call_site_repo.get_call_sites_page_for_callee(callee_usr, after, limit)
+
+    def get_call_sites_for_template_type(self, type_name: str) -> List[Dict[str, Any]]:
+        self._ensure_connected()
+        return self._call_site_repo.get_call_sites_for_template_type(type_name)
 
     def delete_call_sites_by_file(self, file_path: str) -> int:
         self._ensure_connected()
@@ -976,10 +1000,53 @@ class SqliteCacheBackend:
         self._ensure_connected()
         return self._call_site_repo.delete_call_sites_by_usr(usr)
 
+    def delete_call_sites_by_usrs(self, usrs: List[str]) -> int:
+        self._ensure_connected()
+        return self._call_site_repo.delete_call_sites_by_usrs(usrs)
+
     def load_all_call_sites(self) -> List[Dict[str, Any]]:
         self._ensure_connected()
         return self._call_site_repo.load_all_call_sites()
 
+    def get_call_graph_fingerprint(self) -> Optional[Tuple[int, int, int]]:
+        """Return (database id, row count, max row id) of call_sites, for snapshot staleness."""
+        self._ensure_connected()
+        return self._call_site_repo.get_call_graph_fingerprint()
+
+    def load_call_edges(self) -> Tuple[List[Tuple[int, str]], List[Tuple[int, int]]]:
+        """Load distinct call edges as usr_ids ids plus the (id, usr) rows they use."""
+        self._ensure_connected()
+        return self._call_site_repo.load_call_edges()
+
+    def get_reachable_usrs(
+        self, start_usrs: List[str], max_depth: int, reverse: bool, limit: int
+    ) -> Optional[List[Tuple[str, int]]]:
+        """Return (usr, call distance) pairs reachable from start_usrs, nearest first."""
+        self._ensure_connected()
+        return self._call_site_repo.get_reachable_usrs(start_usrs, max_depth, reverse, limit)
+
+    def get_top_call_degrees(
+        self, column: str, limit: int, project_only: bool = False
+    ) -> List[Tuple[str, int, int]]:
+        """Return (usr, in_degree, out_degree) of the functions with the largest column."""
+        self._ensure_connected()
+        return self._call_site_repo.get_top_call_degrees(column, limit, project_only)
+
+    def get_call_degrees(self, usrs: Iterable[str]) -> Dict[str, Tuple[int, int]]:
+        """Return {usr: (in_degree, out_degree)} for usrs that have call sites."""
+        self._ensure_connected()
+        return self._call_site_repo.get_call_degrees(usrs)
+
+    def get_call_degree_totals(self) -> Dict[str, int]:
+        """Return call graph totals read from call_degrees."""
+        self._ensure_connected()
+        return self._call_site_repo.get_call_degree_totals()
+
+    def get_uncalled_functions(self, limit: int) -> List[str]:
+        """Return USRs of project function definitions without indexed callers."""
+        self._ensure_connected()
+        return self._call_site_repo.get_uncalled_functions(limit)
+
     # -------------------------------------------------------------------------
     # Type Aliases Storage and Lookup (Phase 1.3: Type Alias Tracking)
     # -------------------------------------------------------------------------
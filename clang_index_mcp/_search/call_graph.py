@@ -1,9 +1,18 @@
 """Call graph analysis for C++ code."""
 
-from typing import Any, Dict, List, Optional, Set
+import base64
+import binascii
+import json
+from typing import Any, Dict, Iterable, List, Optional, Set, Tuple
 
-from .._symbols.model import SymbolInfo
+from ..cpp_analyzer_config import CppAnalyzerConfig
+from .._symbols.model import SymbolInfo, short_type_name
 from .._symbols.ports.parser import CallSiteRecord
+from .path_search import SearchBudget, find_call_paths
+
+# Call path search limits when the caller does not pass the configured ones
+DEFAULT_PATH_NODE_BUDGET = int(CppAnalyzerConfig.DEFAULT_CONFIG["call_path_node_budget"])
+DEFAULT_PATH_TIMEOUT_MS = float(CppAnalyzerConfig.DEFAULT_CONFIG["call_path_timeout_ms"])
 
 
 class CallSite:
@@ -69,10 +78,42 @@ class CallSite:
         return f"CallSite({self.caller_usr} -> {self.callee_usr} at {self.file}:{self.line})"
 
 
+# Sort key of call site pages: (file, line, caller_usr, callee_usr)
+CallSiteKey = Tuple[str, int, str, str]
+
+
+def call_site_key(call_site: CallSite) -> CallSiteKey:
+    """Total order of call sites used by paginated queries (unique per CallSite)."""
+    return (call_site.file or "", call_site.line or 0, call_site.caller_usr, call_site.callee_usr)
+
+
+def encode_page_token(key: CallSiteKey) -> str:
+    """Opaque continuation token for the page after key."""
+    return base64.urlsafe_b64encode(json.dumps(list(key)).encode()).decode("ascii")
+
+
+def decode_page_token(token: str) -> CallSiteKey:
+    """Key encoded by encode_page_token; raises ValueError for a malformed token."""
+    try:
+        file, line, caller_usr, callee_usr = json.loads(base64.urlsafe_b64decode(token))
+        if isinstance(line, int) and all(
+            isinstance(part, str) for part in (file, caller_usr, callee_usr)
+        ):
+            return (file, line, caller_usr, callee_usr)
+    except (binascii.Error, UnicodeDecodeError, TypeError, ValueError):
+        pass
+    raise ValueError(f"Invalid continuation token: {token!r}")
+
+
 class CallGraphAnalyzer:
     """Manages call graph analysis for C++ code with line-level precision."""
 
-    def __init__(self, cache_backend=None) -> None:
+    def __init__(
+        self,
+        cache_backend=None,
+        path_node_budget: int = DEFAULT_PATH_NODE_BUDGET,
+        path_timeout_ms: float = DEFAULT_PATH_TIMEOUT_MS,
+    ) -> None:
         """
         Initialize CallGraphAnalyzer.
 
@@ -81,6 +122,8 @@ class CallGraphAnalyzer:
                           Required for Task 4.3 memory optimization (~2 GB savings).
                           Call graph relationships are stored ONLY in SQLite,
                           not in memory.
+            path_node_budget: Functions one get_call_paths query may expand.
+            path_timeout_ms: Wall-clock limit of one get_call_paths query.
         """
         # Phase 4: Task 4.3 - Remove in-memory call_graph and reverse_call_graph dicts
         # All call graph queries now go directly to SQLite (~2 GB memory savings)
@@ -92,9 +135,16 @@ class CallGraphAnalyzer:
         self.call_sites: Set[CallSite] = (
             set()
         )  # Current session call sites (using set to avoid duplicates)
+        # The same call sites indexed by caller and by callee USR, so per-function
+        # lookups and removals do not scan the whole session buffer.  Mutate the
+        # buffer only through _index_call_site / _unindex_usrs / clear.
+        self._sites_by_caller: Dict[str, Set[CallSite]] = {}
+        self._sites_by_callee: Dict[str, Set[CallSite]] = {}
 
         # Memory optimization: ALL call graph data stored in SQLite
         self.cache_backend = cache_backend
+        self.path_node_budget = path_node_budget
+        self.path_timeout_ms = path_timeout_ms
 
     def add_call(
         self,
@@ -139,7 +189,38 @@ class CallGraphAnalyzer:
                     display_name,
                     template_project_types,
                 )
-                self.call_sites.add(call_site)  # Using set.add() to automatically deduplicate
+                self._index_call_site(call_site)
+
+    def _index_call_site(self, call_site: CallSite) -> None:
+        """Add a call site to the session buffer and its caller/callee indexes."""
+        if call_site in self.call_sites:
+            return  # Deduplicate (same caller, callee, file and line)
+        self.call_sites.add(call_site)
+        self._sites_by_caller.setdefault(call_site.caller_usr, set()).add(call_site)
+        self._sites_by_callee.setdefault(call_site.callee_usr, set()).add(call_site)
+
+    def _unindex_usrs(self, usrs: Set[str]) -> None:
+        """Drop every session call site whose caller or callee is in usrs."""
+        for usr in usrs:
+            doomed = self._sites_by_caller.pop(usr, set()) | self._sites_by_callee.pop(usr, set())
+            for call_site in doomed:
+                self.call_sites.discard(call_site)
+                for index, key in (
+                    (self._sites_by_caller, call_site.caller_usr),
+                    (self._sites_by_callee, call_site.callee_usr),
+                ):
+                    sites = index.get(key)
+                    if sites is not None:
+                        sites.discard(call_site)
+                        if not sites:
+                            del index[key]
+
+    def _session_sites(self, index: Dict[str, Set[CallSite]], usrs: Iterable[str]) -> Set[CallSite]:
+        """Session call sites of the given callers or callees (index selects which)."""
+        sites: Set[CallSite] = set()
+        for usr in usrs:
+            sites.update(index.get(usr, ()))
+        return sites
 
     def clear(self):
         """
@@ -151,6 +232,8 @@ class CallGraphAnalyzer:
         # Phase 4: Task 4.3 - Removed in-memory call_graph and reverse_call_graph
         # Only clear current session call sites
         self.call_sites.clear()
+        self._sites_by_caller.clear()
+        self._sites_by_callee.clear()
 
     def remove_symbol(self, usr: str):
         """
@@ -158,18 +241,27 @@ class CallGraphAnalyzer:
 
         Phase 4: Task 4.3 - Deletes call sites from SQLite where USR appears as caller or callee.
         """
-        # Phase 4: Task 4.3 - Delete from SQLite instead of in-memory dicts
+        self.remove_symbols([usr])
+
+    def remove_symbols(self, usrs: Iterable[str]) -> None:
+        """
+        Remove several symbols from the call graph at once.
+
+        Deletes their SQLite call sites with one batched statement and drops
+        their session call sites through the caller/callee indexes.
+        """
+        usr_set = set(usrs)
+        if not usr_set:
+            return
         if self.cache_backend:
             try:
-                self.cache_backend.delete_call_sites_by_usr(usr)
+                self.cache_backend.delete_call_sites_by_usrs(sorted(usr_set))
                 # Silently ignore if no call sites found (not an error)
             except Exception:
                 pass  # Silently ignore deletion errors
 
         # Also remove from current session call_sites (if any)
-        self.call_sites = {
-            cs for cs in self.call_sites if cs.caller_usr != usr and cs.callee_usr != usr
-        }
+        self._unindex_usrs(usr_set)
 
     def rebuild_from_symbols(self, symbols: List[SymbolInfo]):
         """
@@ -219,7 +311,7 @@ class CallGraphAnalyzer:
                 display_name=cs_dict.get("display_name"),
                 template_project_types=cs_dict.get("template_project_types"),
             )
-            self.call_sites.add(call_site)  # Using set.add() to automatically deduplicate
+            self._index_call_site(call_site)
 
     def find_incoming_calls(self, function_usr: str) -> Set[str]:
         """
@@ -242,9 +334,8 @@ class CallGraphAnalyzer:
                 pass  # Silently ignore DB errors, return empty set
 
         # Also check current session call_sites (before they're saved to SQLite)
-        for cs in self.call_sites:
-            if cs.callee_usr == function_usr:
-                result.add(cs.caller_usr)
+        for cs in self._sites_by_callee.get(function_usr, ()):
+            result.add(cs.caller_usr)
 
         return result
 
@@ -269,73 +360,156 @@ class CallGraphAnalyzer:
                 pass  # Silently ignore DB errors, return empty set
 
         # Also check current session call_sites (before they're saved to SQLite)
-        for cs in self.call_sites:
-            if cs.caller_usr == function_usr:
-                result.add(cs.callee_usr)
+        for cs in self._sites_by_caller.get(function_usr, ()):
+            result.add(cs.callee_usr)
 
         return result
 
-    def get_call_paths(self, from_usr: str, to_usr: str, max_depth: int = 10) -> List[List[str]]:
-        """Find all call paths from one function to another"""
-        if from_usr == to_usr:
-            return [[from_usr]]
-
-        if max_depth <= 0:
-            return []
+    def get_call_paths(
+        self, from_usr: str, to_usr: str, max_depth: int = 10, max_paths: int = 10
+    ) -> List[List[str]]:
+        """Find the shortest call paths (at most max_depth calls) from one function to another.
 
-        paths = []
+        Returns up to max_paths simple paths, shortest first.
+        """
+        budget = SearchBudget(self.path_node_budget, self.path_timeout_ms)
+        paths = find_call_paths(
+            {from_usr},
+            {to_usr},
+            self.find_callees,
+            self.find_incoming_calls,
+            max_depth,
+            max_paths,
+            budget,
+        )
+        return [[str(usr) for usr in path] for path in paths]
 
-        # Get direct callees
-        callees = self.find_callees(from_usr)
+    def get_call_statistics(self, limit: int = 10, project_only: bool = False) -> Dict[str, Any]:
+        """
+        Get project-wide statistics about the call graph.
 
-        for callee in callees:
-            if callee == to_usr:
-                # Direct call found
-                paths.append([from_usr, to_usr])
-            else:
-                # Recursively search for paths
-                sub_paths = self.get_call_paths(callee, to_usr, max_depth - 1)
-                for sub_path in sub_paths:
-                    paths.append([from_usr] + sub_path)
+        Totals and the top lists come from the call_degrees counters in
+        SQLite, merged with the session call sites that are not saved there.
 
-        return paths
+        Args:
+            limit: Length of the most_called_functions / functions_with_most_calls lists
+            project_only: Rank only functions indexed as project symbols in SQLite
+                (session-only functions are not filtered)
 
-    def get_call_statistics(self) -> Dict[str, Any]:
+        Returns:
+            Dictionary with function/call site totals and (usr, call site count) lists
         """
-        Get statistics about the call graph.
-
-        DEPRECATED (Phase 4, Task 4.3): This method is now deprecated.
-        The in-memory call_graph and reverse_call_graph dicts were removed
-        to save ~2 GB of memory. Statistics would require expensive SQLite queries.
+        session = self._session_call_degrees()
+        stored = self._stored_call_degrees(session)
+        totals = {"functions_with_calls": 0, "functions_being_called": 0, "call_sites": 0}
+        if self.cache_backend:
+            try:
+                totals = self.cache_backend.get_call_degree_totals()
+            except Exception:
+                pass  # Silently ignore DB errors, report session counts only
+        for usr, (session_in, session_out) in session.items():
+            stored_in, stored_out = stored.get(usr, (0, 0))
+            if session_out and not stored_out:
+                totals["functions_with_calls"] += 1
+            if session_in and not stored_in:
+                totals["functions_being_called"] += 1
+            totals["call_sites"] += session_in
 
-        Returns placeholder data for backward compatibility.
-        """
-        # Phase 4: Task 4.3 - Return placeholder data (method deprecated)
         return {
-            "total_functions_with_calls": 0,
-            "total_functions_being_called": 0,
-            "total_unique_calls": 0,
-            "most_called_functions": [],
-            "functions_with_most_calls": [],
-            "note": "DEPRECATED: get_call_statistics() is deprecated in Phase 4 (Task 4.3). "
-            "Use SQLite queries directly for call graph statistics if needed.",
+            "total_functions_with_calls": totals["functions_with_calls"],
+            "total_functions_being_called": totals["functions_being_called"],
+            "total_unique_calls": totals["call_sites"],
+            # (usr, call sites calling it) / (usr, call sites inside it) pairs
+            "most_called_functions": self._top_call_degrees(
+                0, limit, project_only, session, stored
+            ),
+            "functions_with_most_calls": self._top_call_degrees(
+                1, limit, project_only, session, stored
+            ),
         }
 
-    def _get_most_called_functions(self, limit: int) -> List[tuple]:
+    def _top_call_degrees(
+        self,
+        position: int,
+        limit: int,
+        project_only: bool,
+        session: Dict[str, Tuple[int, int]],
+        stored: Dict[str, Tuple[int, int]],
+    ) -> List[tuple]:
+        """Top limit functions by in-degree (position 0) or out-degree (position 1).
+
+        Only session functions can outrank the stored top list, so the stored
+        top limit plus the session functions are enough to rank exactly.
+        session and stored are the degrees of the session functions, as
+        computed once per get_call_statistics call.
         """
-        Get the most frequently called functions.
+        counts: Dict[str, Tuple[int, int]] = {}
+        if self.cache_backend and limit > 0:
+            column = "in_degree" if position == 0 else "out_degree"
+            try:
+                rows = self.cache_backend.get_top_call_degrees(column, limit, project_only)
+                counts = {usr: (in_degree, out_degree) for usr, in_degree, out_degree in rows}
+            except Exception:
+                pass  # Silently ignore DB errors, rank session call sites only
+        for usr, (session_in, session_out) in session.items():
+            stored_in, stored_out = stored.get(usr, (0, 0))
+            counts[usr] = (stored_in + session_in, stored_out + session_out)
+
+        ranked = sorted(
+            ((usr, degrees[position]) for usr, degrees in counts.items() if degrees[position]),
+            key=lambda item: (-item[1], item[0]),
+        )
+        return ranked[:limit]
 
-        DEPRECATED (Phase 4, Task 4.3): Placeholder for backward compatibility.
+    def get_uncalled_functions(self, limit: int) -> List[str]:
         """
-        return []
+        Get USRs of project function definitions that no indexed call site calls.
 
-    def _get_functions_with_most_calls(self, limit: int) -> List[tuple]:
+        These are dead code candidates (see CallSiteRepository.get_uncalled_functions
+        for what is excluded); functions called from session call sites are dropped.
         """
-        Get functions that make the most calls.
+        if not self.cache_backend:
+            return []
+        try:
+            # Over-fetch by the session callees, which may drop out below
+            usrs = self.cache_backend.get_uncalled_functions(limit + len(self._sites_by_callee))
+        except Exception:
+            return []
+        return [usr for usr in usrs if usr not in self._sites_by_callee][:limit]
 
-        DEPRECATED (Phase 4, Task 4.3): Placeholder for backward compatibility.
-        """
-        return []
+    def _session_call_degrees(self) -> Dict[str, Tuple[int, int]]:
+        """(call sites calling it, call sites inside it) per USR of the session call sites."""
+        return {
+            usr: (len(self._sites_by_callee.get(usr, ())), len(self._sites_by_caller.get(usr, ())))
+            for usr in self._sites_by_callee.keys() | self._sites_by_caller.keys()
+        }
+
+    def _stored_call_degrees(self, usrs: Iterable[str]) -> Dict[str, Tuple[int, int]]:
+        """call_degrees counters of usrs in SQLite; empty without a backend."""
+        if not self.cache_backend or not usrs:
+            return {}
+        try:
+            return dict(self.cache_backend.get_call_degrees(list(usrs)))
+        except Exception:
+            return {}
+
+    def get_overridden_methods(self, usrs: Iterable[str]) -> Set[str]:
+        """Base methods the given methods override, transitively (method_overrides)."""
+        if not self.cache_backend or not usrs:
+            return set()
+        try:
+            return set(self.cache_backend.get_overridden_methods(sorted(usrs)))
+        except Exception:
+            return set()
+
+    def get_overriding_methods(self, usrs: Iterable[str]) -> List[Tuple[str, str]]:
+        """(override, directly overridden method) USR pairs below the given methods."""
+        if not self.cache_backend or not usrs:
+            return []
+        try:
+            return list(self.cache_backend.get_overriding_methods(sorted(usrs)))
+        except Exception:
+            return []
 
     # Phase 3: Line-level call site methods
 
@@ -353,7 +527,7 @@ class CallGraphAnalyzer:
             List of CallSite objects for this caller
         """
         # First, get call sites from current session (in-memory)
-        current_session = [cs for cs in self.call_sites if cs.caller_usr == caller_usr]
+        current_session = list(self._sites_by_caller.get(caller_usr, ()))
 
         # Then, get historical call sites from SQLite (lazy loading)
         if self.cache_backend:
@@ -391,7 +565,7 @@ class CallGraphAnalyzer:
             List of CallSite objects for this callee
         """
         # First, get call sites from current session (in-memory)
-        current_session = [cs for cs in self.call_sites if cs.callee_usr == callee_usr]
+        current_session = list(self._sites_by_callee.get(callee_usr, ()))
 
         # Then, get historical call sites from SQLite (lazy loading)
         if self.cache_backend:
@@ -415,6 +589,141 @@ class CallGraphAnalyzer:
 
         return sorted(current_session, key=lambda cs: (cs.file, cs.line))
 
+    def get_call_sites_for_callers(self, caller_usrs: Iterable[str]) -> List[CallSite]:
+        """
+        Get all call sites from any of several caller functions.
+
+        Batched form of get_call_sites_for_caller: one SQLite query for all
+        callers instead of one per caller.
+        """
+        return self._get_call_sites_for_usrs(set(caller_usrs), callers=True)
+
+    def get_call_sites_for_callees(self, callee_usrs: Iterable[str]) -> List[CallSite]:
+        """
+        Get all call sites to any of several callee functions.
+
+        Batched form of get_call_sites_for_callee: one SQLite query for all
+        callees instead of one per callee.
+        """
+        return self._get_call_sites_for_usrs(set(callee_usrs), callers=False)
+
+    def get_call_sites_page_for_callees(
+        self, callee_usrs: Iterable[str], after: Optional[CallSiteKey], limit: int
+    ) -> Tuple[List[CallSite], Optional[CallSiteKey]]:
+        """
+        One page of the call sites to any of several callees, in call_site_key order.
+
+        Each callee contributes at most limit + 2 distinct call sites, read from
+        SQLite in index order: a full page, one more to tell whether another
+        page follows, and the last site of the previous page, which the
+        inclusive lower bound returns again.  The page is merged from those and
+        the session call sites.  The work per page therefore depends on the
+        page size rather than on how many call sites the callees have.
+
+        Returns:
+            The page and the key to pass as after for the next page (None on the
+            last page).
+        """
+        usrs = set(callee_usrs)
+        candidates = {
+            cs
+            for cs in self._session_sites(self._sites_by_callee, usrs)
+            if after is None or call_site_key(cs) > after
+        }
+        if self.cache_backend:
+            try:
+                for usr in sorted(usrs):
+                    # The SQLite lower bound is inclusive; a site equal to after is dropped
+                    rows = self.cache_backend.get_call_sites_page_for_callee(
+                        usr, after[:3] if after else None, limit + 2
+                    )
+                    for cs_dict in rows:
+                        call_site = CallSite(
+                            caller_usr=cs_dict["caller_usr"],
+                            callee_usr=cs_dict["callee_usr"],
+                            file=cs_dict["file"],
+                            line=cs_dict["line"],
+                            column=cs_dict.get("column"),
+                            display_name=cs_dict.get("display_name"),
+                            template_project_types=cs_dict.get("template_project_types"),
+                        )
+                        if after is None or call_site_key(call_site) > after:
+                            candidates.add(call_site)
+            except Exception:
+                pass  # SQLite errors shouldn't break the query
+
+        ordered = sorted(candidates, key=call_site_key)
+        page = ordered[:limit]
+        next_key = call_site_key(page[-1]) if len(ordered) > limit else None
+        return page, next_key
+
+    def _get_call_sites_for_usrs(self, usrs: Set[str], callers: bool) -> List[CallSite]:
+        if not usrs:
+            return []
+        sites = self._session_sites(
+            self._sites_by_caller if callers else self._sites_by_callee, usrs
+        )
+        if self.cache_backend:
+            try:
+                if callers:
+                    db_results = self.cache_backend.get_call_sites_for_callers(sorted(usrs))
+                else:
+                    db_results = self.cache_backend.get_call_sites_for_callees(sorted(usrs))
+                for cs_dict in db_results:
+                    sites.add(
+                        CallSite(
+                            caller_usr=cs_dict["caller_usr"],
+                            callee_usr=cs_dict["callee_usr"],
+                            file=cs_dict["file"],
+                            line=cs_dict["line"],
+                            column=cs_dict.get("column"),
+                            display_name=cs_dict.get("display_name"),
+                            template_project_types=cs_dict.get("template_project_types"),
+                        )
+                    )
+            except Exception:
+                pass  # SQLite errors shouldn't break the query
+
+        return sorted(sites, key=lambda cs: (cs.file, cs.line))
+
+    def get_call_sites_for_template_type(self, type_name: str) -> List[CallSite]:
+        """
+        Get template-mediated call sites whose project template types include type_name.
+
+        type_name is a recorded type spelling ("app::Sensor") or its unqualified
+        name ("Sensor").  SQLite answers through its type index; session call
+        sites are few, so they are checked one by one.
+        """
+        sites: Set[CallSite] = set()
+        for call_site in self.call_sites:
+            if not call_site.template_project_types:
+                continue
+            try:
+                type_names = json.loads(call_site.template_project_types)
+            except (TypeError, ValueError):
+                continue
+            if any(type_name in (name, short_type_name(name)) for name in type_names):
+                sites.add(call_site)
+
+        if self.cache_backend:
+            try:
+                for cs_dict in self.cache_backend.get_call_sites_for_template_type(type_name):
+                    sites.add(
+                        CallSite(
+                            caller_usr=cs_dict["caller_usr"],
+                            callee_usr=cs_dict["callee_usr"],
+                            file=cs_dict["file"],
+                            line=cs_dict["line"],
+                            column=cs_dict.get("column"),
+                            display_name=cs_dict.get("display_name"),
+                            template_project_types=cs_dict.get("template_project_types"),
+                        )
+                    )
+            except Exception:
+                pass  # SQLite errors shouldn't break the query
+
+        return sorted(sites, key=lambda cs: (cs.file, cs.line))
+
     def get_all_call_sites(self) -> List[Dict[str, Any]]:
         """
         Get all call sites as dictionaries for storage.
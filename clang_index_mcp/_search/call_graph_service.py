@@ -6,15 +6,28 @@ and call paths between functions.
 """
 
 import json
-from typing import Any, Dict, List, Optional, Set
+import threading
+from typing import Any, Callable, Dict, Iterable, List, Optional, Set, Tuple
 
 from .._core import diagnostics
-from .._search.call_graph import CallGraphAnalyzer
+from .._search.call_graph import (
+    DEFAULT_PATH_NODE_BUDGET,
+    DEFAULT_PATH_TIMEOUT_MS,
+    CallGraphAnalyzer,
+    decode_page_token,
+    encode_page_token,
+)
+from .._search.call_graph_snapshot import CallGraphSnapshot, Fingerprint
 from .._search.dependency_graph import DependencyGraphBuilder
+from .._search.path_search import SearchBudget, find_call_paths, reachable_depths
 from .._persistence.cache_manager import CacheManager
+from .._search.query_cache import QueryResultCache
 from .._symbols.usr_decoder import usr_to_display_name
 from .._symbols.model import build_location_objects, omit_empty
 
+# Call sites per page when a continuation token is given without a page size
+DEFAULT_CALL_SITE_PAGE_SIZE = 100
+
 
 class CallGraphService:
     """
@@ -22,27 +35,70 @@ class CallGraphService:
     and call path queries.
     """
 
-    def __init__(self, cache_manager: CacheManager):
+    def __init__(
+        self,
+        cache_manager: CacheManager,
+        max_call_paths: int = 10,
+        path_node_budget: int = DEFAULT_PATH_NODE_BUDGET,
+        path_timeout_ms: float = DEFAULT_PATH_TIMEOUT_MS,
+    ):
         """
         Initialize CallGraphService.
 
         Args:
             cache_manager: Cache manager for persistent call site storage.
+            max_call_paths: Number of shortest paths returned by get_call_path.
+            path_node_budget: Functions one get_call_path query may expand.
+            path_timeout_ms: Wall-clock limit of one get_call_path query.
         """
         self.cache_manager = cache_manager
+        self.max_call_paths = max_call_paths
+        self.path_node_budget = path_node_budget
+        self.path_timeout_ms = path_timeout_ms
 
         # Dependencies set after construction to break the circular dependency
         # between CallGraphService and SymbolIndexStore/QueryEngine.
         self.symbol_store: Any = None
         self.query_engine: Any = None
 
-        self.call_graph_analyzer = CallGraphAnalyzer()
+        self.call_graph_analyzer = CallGraphAnalyzer(
+            path_node_budget=path_node_budget, path_timeout_ms=path_timeout_ms
+        )
         self.dependency_graph: Optional[DependencyGraphBuilder] = None
+        self.query_cache: Optional[QueryResultCache] = None
+
+        # Advanced when call edges change without a symbol index mutation
+        # (streamed call sites); the symbol store generation covers the rest
+        self.call_edge_version = 0
 
-    def set_dependencies(self, symbol_store: Any, query_engine: Any) -> None:
-        """Wire symbol store and query engine after they are created."""
+        # CSR snapshot for multi-hop traversals, revalidated per call graph generation
+        self._snapshot_lock = threading.Lock()
+        self._snapshot: Optional[CallGraphSnapshot] = None
+        self._snapshot_generation: Optional[Tuple[int, int]] = None
+
+    def set_dependencies(
+        self,
+        symbol_store: Any,
+        query_engine: Any,
+        query_cache: Optional[QueryResultCache] = None,
+    ) -> None:
+        """Wire symbol store, query engine and result cache after they are created."""
         self.symbol_store = symbol_store
         self.query_engine = query_engine
+        self.query_cache = query_cache
+
+    def _call_graph_generation(self) -> Tuple[int, int]:
+        """(symbol store generation, call edge version): changes with either."""
+        generation = self.symbol_store.generation if self.symbol_store is not None else -1
+        return generation, self.call_edge_version
+
+    def _cached(self, operation: str, args: Tuple[Any, ...], compute: Callable[[], Any]) -> Any:
+        """Run compute() through the query result cache, if one is configured."""
+        if self.query_cache is None:
+            return compute()
+        return self.query_cache.get_or_compute(
+            operation, args, self._call_graph_generation(), compute
+        )
 
     def set_dependency_graph(self, builder: Optional[DependencyGraphBuilder]) -> None:
         """Set the dependency graph builder, wired by the composition root."""
@@ -56,6 +112,80 @@ class CallGraphService:
         """Wire the call graph analyzer to the SQLite cache backend."""
         self.call_graph_analyzer.cache_backend = self.cache_manager.backend
 
+    # ------------------------------------------------------------------
+    # Call graph snapshot (multi-hop traversals)
+    # ------------------------------------------------------------------
+
+    def call_graph_snapshot(self, build: bool = True) -> Optional[CallGraphSnapshot]:
+        """Return a CSR snapshot matching the call_sites table, building it if needed.
+
+        The snapshot is reused while the call graph generation is unchanged,
+        then revalidated against the call_sites fingerprint; a stale snapshot
+        is rebuilt and saved to the cache directory.  Returns None when there
+        is no SQLite backend or when session call sites exist that are not in
+        SQLite (traversals then query per node).  With build=False a stale
+        snapshot is not rebuilt and None is returned instead.
+        """
+        backend = self.cache_manager.backend if self.cache_manager else None
+        if backend is None or self.call_graph_analyzer.call_sites:
+            return None
+        generation = self._call_graph_generation()
+
+        with self._snapshot_lock:
+            if self._snapshot is not None and self._snapshot_generation == generation:
+                return self._snapshot
+
+            fingerprint = backend.get_call_graph_fingerprint()
+            if not isinstance(fingerprint, tuple):
+                return None
+            snapshot = self._snapshot
+            if snapshot is None or snapshot.fingerprint != fingerprint:
+                snapshot = self._load_or_build_snapshot(backend, fingerprint, build)
+                if snapshot is None:
+                    return None
+
+            self._snapshot = snapshot
+            self._snapshot_generation = generation
+            return snapshot
+
+    def refresh_call_graph_snapshot(self) -> None:
+        """Bring the saved snapshot up to date (called after indexing and refresh)."""
+        try:
+            self.call_graph_snapshot()
+        except Exception as e:
+            diagnostics.warning(f"Failed to build call graph snapshot: {e}")
+
+    def _load_or_build_snapshot(
+        self, backend: Any, fingerprint: Fingerprint, build: bool = True
+    ) -> Optional[CallGraphSnapshot]:
+        path = self.cache_manager.cache_dir / "call_graph.csr"
+        snapshot = CallGraphSnapshot.load(path)
+        if snapshot is not None and snapshot.fingerprint == fingerprint:
+            return snapshot
+        if not build:
+            return None
+
+        usr_rows, edges = backend.load_call_edges()
+        snapshot = CallGraphSnapshot.build(usr_rows, edges, fingerprint)
+        try:
+            snapshot.save(path)
+        except OSError as e:
+            diagnostics.debug(f"Could not save call graph snapshot: {e}")
+        diagnostics.debug(
+            f"Call graph snapshot: {snapshot.node_count} functions, "
+            f"{snapshot.edge_count} edges"
+        )
+        return snapshot
+
+    def _neighbor_lookups(
+        self,
+    ) -> Tuple[Callable[[str], Iterable[str]], Callable[[str], Iterable[str]]]:
+        """Return (callees of usr, callers of usr), backed by the snapshot when available."""
+        snapshot = self.call_graph_snapshot()
+        if snapshot is not None:
+            return snapshot.callees, snapshot.callers
+        return self.call_graph_analyzer.find_callees, self.call_graph_analyzer.find_incoming_calls
+
     # ------------------------------------------------------------------
     # Call site streaming (used during indexing)
     # ------------------------------------------------------------------
@@ -77,6 +207,8 @@ class CallGraphService:
         if cache_manager and cache_manager.backend:
             cache_manager.backend.delete_call_sites_by_file(file_path)
             cache_manager.backend.save_call_sites_batch(call_sites)
+        # Call edges changed without a symbol index mutation
+        self.call_edge_version += 1
 
         for cs_dict in call_sites:
             self.call_graph_analyzer.add_call(
@@ -98,6 +230,9 @@ class CallGraphService:
         class_name: str = "",
         include_call_sites: bool = True,
         project_only: bool = True,
+        include_virtual_dispatch: bool = False,
+        page_size: Optional[int] = None,
+        cursor: Optional[str] = None,
     ) -> Dict[str, Any]:
         """
         Find all functions that call the specified function.
@@ -109,12 +244,46 @@ class CallGraphService:
             project_only: When True (default), only return callers from project files.
                 When False, also include callers from external dependencies (shown as
                 {"usr": "<USR>", "is_project": false} entries since no metadata is indexed).
+            include_virtual_dispatch: When True, also return callers of the base class
+                methods the target overrides; those calls may dispatch to the target
+                at runtime and are marked with "via_virtual" (the statically called method).
+            page_size: When set, return one page of at most page_size call sites in
+                (file, line) order, and the callers making them, instead of all of them
+            cursor: Continuation token (next_cursor of the previous page)
 
         Returns:
             Dictionary with:
                 - callers: List of caller function info (backward compatible)
                 - call_sites: List of call site locations (Phase 3, if include_call_sites=True)
+                - next_cursor: Token for the next page (paginated queries with more pages)
+
+        Raises:
+            ValueError: If cursor is not a token returned by a previous page
         """
+        if cursor and page_size is None:
+            page_size = DEFAULT_CALL_SITE_PAGE_SIZE
+        args = (
+            function_name,
+            class_name,
+            include_call_sites,
+            project_only,
+            include_virtual_dispatch,
+            page_size,
+            cursor,
+        )
+        return self._cached("find_incoming_calls", args, lambda: self._find_incoming_calls(*args))
+
+    def _find_incoming_calls(
+        self,
+        function_name: str,
+        class_name: str,
+        include_call_sites: bool,
+        project_only: bool,
+        include_virtual_dispatch: bool,
+        page_size: Optional[int],
+        cursor: Optional[str],
+    ) -> Dict[str, Any]:
+        after = decode_page_token(cursor) if cursor else None
         callers_list: List[Dict[str, Any]] = []
         call_sites_list: List[Dict[str, Any]] = []
 
@@ -123,18 +292,42 @@ class CallGraphService:
         )
 
         target_usrs = self._collect_target_usrs(target_functions)
+        base_usrs = self._overridden_methods(target_usrs) if include_virtual_dispatch else set()
+
+        # One batched query returns the callers and the call sites of all targets
+        next_key = None
+        if page_size is None:
+            call_sites = self.call_graph_analyzer.get_call_sites_for_callees(
+                target_usrs | base_usrs
+            )
+        else:
+            call_sites, next_key = self.call_graph_analyzer.get_call_sites_page_for_callees(
+                target_usrs | base_usrs, after, page_size
+            )
+        callers_by_target: Dict[str, Dict[str, None]] = {}
+        for call_site in call_sites:
+            callers_by_target.setdefault(call_site.callee_usr, {})[call_site.caller_usr] = None
+        symbols = self.symbol_store.get_symbols_by_usrs(
+            {cs.caller_usr for cs in call_sites} | base_usrs
+        )
+        via_virtual = {usr: self._method_display_name(symbols.get(usr), usr) for usr in base_usrs}
 
-        total_raw_callers = 0
-        for usr in target_usrs:
-            callers = self.call_graph_analyzer.find_incoming_calls(usr)
-            total_raw_callers += len(callers)
+        total_raw_callers = len(call_sites)
+        for callee_usr, callers in callers_by_target.items():
             for caller_usr in callers:
-                self._add_caller(caller_usr, callers_list, project_only)
+                added = len(callers_list)
+                self._add_caller(symbols.get(caller_usr), caller_usr, callers_list, project_only)
+                if callee_usr in via_virtual and len(callers_list) > added:
+                    callers_list[-1]["via_virtual"] = via_virtual[callee_usr]
 
-            if include_call_sites:
-                call_sites = self.call_graph_analyzer.get_call_sites_for_callee(usr)
-                for call_site in call_sites:
-                    self._add_call_site(call_site, call_sites_list, project_only)
+        if include_call_sites:
+            for call_site in call_sites:
+                added = len(call_sites_list)
+                self._add_call_site(
+                    symbols.get(call_site.caller_usr), call_site, call_sites_list, project_only
+                )
+                if call_site.callee_usr in via_virtual and len(call_sites_list) > added:
+                    call_sites_list[-1]["via_virtual"] = via_virtual[call_site.callee_usr]
 
         target_qualified_name = (
             target_functions[0]["qualified_name"] if target_functions else function_name
@@ -151,6 +344,8 @@ class CallGraphService:
             call_sites_list.sort(key=lambda cs: (cs["file"], cs["line"]))
             result["call_sites"] = call_sites_list
             result["total_call_sites"] = len(call_sites_list)
+        if next_key is not None:
+            result["next_cursor"] = encode_page_token(next_key)
 
         return result
 
@@ -171,6 +366,12 @@ class CallGraphService:
                 - function: The source function name
                 - callees: List of callee function info
         """
+        args = (function_name, class_name, project_only)
+        return self._cached("find_callees", args, lambda: self._find_callees(*args))
+
+    def _find_callees(
+        self, function_name: str, class_name: str, project_only: bool
+    ) -> Dict[str, Any]:
         callees_list: List[Dict[str, Any]] = []
 
         target_functions = self.query_engine.search_functions(
@@ -179,12 +380,26 @@ class CallGraphService:
 
         target_usrs = self._collect_target_usrs(target_functions)
 
-        total_raw_callees = 0
-        for usr in target_usrs:
-            callees = self.call_graph_analyzer.find_callees(usr)
-            total_raw_callees += len(callees)
+        # One batched query returns the callees and the call sites of all sources
+        call_sites = self.call_graph_analyzer.get_call_sites_for_callers(target_usrs)
+        callees_by_source: Dict[str, Dict[str, None]] = {}
+        template_sites: Dict[str, Any] = {}
+        for call_site in call_sites:
+            callees_by_source.setdefault(call_site.caller_usr, {})[call_site.callee_usr] = None
+            if call_site.template_project_types:
+                template_sites.setdefault(call_site.callee_usr, call_site)
+        symbols = self.symbol_store.get_symbols_by_usrs({cs.callee_usr for cs in call_sites})
+
+        total_raw_callees = len(call_sites)
+        for callees in callees_by_source.values():
             for callee_usr in callees:
-                self._add_callee(callee_usr, callees_list, project_only, target_usrs)
+                self._add_callee(
+                    symbols.get(callee_usr),
+                    callee_usr,
+                    callees_list,
+                    project_only,
+                    template_sites.get(callee_usr),
+                )
 
         target_qualified_name = (
             target_functions[0]["qualified_name"] if target_functions else function_name
@@ -208,6 +423,10 @@ class CallGraphService:
         Returns:
             List of call site dictionaries with exact file:line:column locations
         """
+        args = (function_name, class_name)
+        return self._cached("get_call_sites", args, lambda: self._get_call_sites(*args))
+
+    def _get_call_sites(self, function_name: str, class_name: str) -> List[Dict[str, Any]]:
         call_sites_list: List[Dict[str, Any]] = []
 
         source_functions = self.query_engine.search_functions(
@@ -216,13 +435,15 @@ class CallGraphService:
 
         source_usrs = self._collect_target_usrs(source_functions)
 
-        for usr in source_usrs:
-            call_sites = self.call_graph_analyzer.get_call_sites_for_caller(usr)
-            for call_site in call_sites:
-                if self.symbol_store.contains_usr(call_site.callee_usr):
-                    call_sites_list.append(self._build_call_site_entry(call_site))
-                else:
-                    self._add_external_call_site(call_site, call_sites_list)
+        call_sites = self.call_graph_analyzer.get_call_sites_for_callers(source_usrs)
+        symbols = self.symbol_store.get_symbols_by_usrs({cs.callee_usr for cs in call_sites})
+        for call_site in call_sites:
+            if self.symbol_store.contains_usr(call_site.callee_usr):
+                call_sites_list.append(
+                    self._build_call_site_entry(symbols[call_site.callee_usr], call_site)
+                )
+            else:
+                self._add_external_call_site(call_site, call_sites_list)
 
         call_sites_list.sort(key=lambda cs: (cs["file"], cs["line"]))
 
@@ -231,7 +452,13 @@ class CallGraphService:
     def get_call_path(
         self, from_function: str, to_function: str, max_depth: int = 10
     ) -> List[List[str]]:
-        """Find call paths from one function to another using BFS"""
+        """Find the shortest call paths from one function to another"""
+        args = (from_function, to_function, max_depth)
+        return self._cached("get_call_path", args, lambda: self._get_call_path(*args))
+
+    def _get_call_path(
+        self, from_function: str, to_function: str, max_depth: int
+    ) -> List[List[str]]:
         from_funcs = self.query_engine.search_functions(from_function, project_only=False)
         to_funcs = self.query_engine.search_functions(to_function, project_only=False)
 
@@ -243,10 +470,313 @@ class CallGraphService:
 
         return self._find_paths_bfs(from_usrs, to_usrs, max_depth)
 
+    def find_transitive_callers(
+        self,
+        function_name: str,
+        class_name: str = "",
+        max_depth: int = 3,
+        max_nodes: int = 500,
+        project_only: bool = True,
+    ) -> Dict[str, Any]:
+        """
+        Find every function that reaches the specified function within max_depth calls.
+
+        Args:
+            function_name: Name of the target function
+            class_name: Optional class name to disambiguate methods
+            max_depth: Maximum call distance from the target
+            max_nodes: Maximum number of functions the traversal may reach
+            project_only: When True (default), only report project functions.
+                External functions are still traversed.
+
+        Returns:
+            Dictionary with:
+                - by_depth: [{"depth": d, "functions": [...]}] for d = 1..max_depth
+                - by_file: {file: [qualified names]} of the reported functions
+                - total: Number of reported functions
+                - truncated: True if the traversal stopped at max_nodes
+        """
+        args = (function_name, class_name, True, max_depth, max_nodes, project_only)
+        return self._cached(
+            "find_transitive_calls", args, lambda: self._find_transitive_calls(*args)
+        )
+
+    def find_transitive_callees(
+        self,
+        function_name: str,
+        class_name: str = "",
+        max_depth: int = 3,
+        max_nodes: int = 500,
+        project_only: bool = True,
+    ) -> Dict[str, Any]:
+        """
+        Find every function reachable from the specified function within max_depth calls.
+
+        Takes the same arguments and returns the same shape as
+        find_transitive_callers.
+        """
+        args = (function_name, class_name, False, max_depth, max_nodes, project_only)
+        return self._cached(
+            "find_transitive_calls", args, lambda: self._find_transitive_calls(*args)
+        )
+
+    def _find_transitive_calls(
+        self,
+        function_name: str,
+        class_name: str,
+        reverse: bool,
+        max_depth: int,
+        max_nodes: int,
+        project_only: bool,
+    ) -> Dict[str, Any]:
+        target_functions = self.query_engine.search_functions(
+            function_name, project_only=False, class_name=class_name
+        )
+        target_usrs = self._collect_target_usrs(target_functions)
+        depths, truncated = self._reachable(target_usrs, max_depth, max_nodes, reverse)
+
+        levels: Dict[int, List[Dict[str, Any]]] = {}
+        by_file: Dict[str, List[str]] = {}
+        symbols = self.symbol_store.get_symbols_by_usrs(depths)
+        for usr, depth in depths.items():
+            entry = self._function_entry(symbols.get(usr), usr, project_only)
+            if entry is None:
+                continue
+            levels.setdefault(depth, []).append(entry)
+            if "file" in entry:
+                by_file.setdefault(entry["file"], []).append(entry["qualified_name"])
+
+        by_depth = [
+            {
+                "depth": depth,
+                "functions": sorted(levels[depth], key=lambda e: e["qualified_name"]),
+            }
+            for depth in sorted(levels)
+        ]
+        target_qualified_name = (
+            target_functions[0]["qualified_name"] if target_functions else function_name
+        )
+        return {
+            "function": function_name,
+            "direction": "callers" if reverse else "callees",
+            "max_depth": max_depth,
+            "by_depth": by_depth,
+            "by_file": {file: sorted(names) for file, names in sorted(by_file.items())},
+            "total": sum(len(level) for level in levels.values()),
+            "truncated": truncated,
+            "_function_found": len(target_usrs) > 0,
+            "_has_any_in_graph": len(depths) > 0,
+            "_target_qualified_name": target_qualified_name,
+        }
+
+    def get_call_hotspots(self, limit: int = 10, project_only: bool = True) -> Dict[str, Any]:
+        """
+        Report project-wide call graph hotspots.
+
+        Read from the per-function call degree counters kept in SQLite, so
+        the cost depends on limit rather than on the size of the call graph.
+
+        Args:
+            limit: Maximum number of functions per list
+            project_only: When True (default), only rank project functions
+
+        Returns:
+            Dictionary with:
+                - most_called: Functions with the most call sites calling them (call_count)
+                - most_calls_made: Functions with the most call sites inside them
+                  (calls_made), i.e. fan-out outliers
+                - uncalled: Project function definitions no indexed call reaches
+                  (dead code candidates)
+                - totals: Functions making calls, functions being called, call sites
+                  and the average calls made per calling function
+        """
+        args = (limit, project_only)
+        return self._cached("get_call_hotspots", args, lambda: self._get_call_hotspots(*args))
+
+    def _get_call_hotspots(self, limit: int, project_only: bool) -> Dict[str, Any]:
+        analyzer = self.call_graph_analyzer
+        stats = analyzer.get_call_statistics(limit, project_only)
+        uncalled_usrs = analyzer.get_uncalled_functions(limit)
+        ranked = {
+            "most_called": ("call_count", stats["most_called_functions"]),
+            "most_calls_made": ("calls_made", stats["functions_with_most_calls"]),
+        }
+        symbols = self.symbol_store.get_symbols_by_usrs(
+            {usr for _, pairs in ranked.values() for usr, _ in pairs} | set(uncalled_usrs)
+        )
+
+        result: Dict[str, Any] = {}
+        for key, (count_field, pairs) in ranked.items():
+            entries = []
+            for usr, count in pairs:
+                entry = self._function_entry(symbols.get(usr), usr, project_only)
+                if entry is not None:
+                    entry[count_field] = count
+                    entries.append(entry)
+            result[key] = entries
+        uncalled = (self._function_entry(symbols.get(usr), usr, True) for usr in uncalled_usrs)
+        result["uncalled"] = [entry for entry in uncalled if entry is not None]
+
+        calling = stats["total_functions_with_calls"]
+        result["totals"] = {
+            "functions_with_calls": calling,
+            "functions_being_called": stats["total_functions_being_called"],
+            "call_sites": stats["total_unique_calls"],
+            "average_calls_made": (
+                round(stats["total_unique_calls"] / calling, 2) if calling else 0.0
+            ),
+        }
+        return result
+
+    def find_overrides(
+        self, function_name: str, class_name: str = "", project_only: bool = True
+    ) -> Dict[str, Any]:
+        """
+        Find every override of a virtual method across the class hierarchy.
+
+        The overrides recorded from libclang at index time (method_overrides)
+        are followed downwards in one recursive query, so overrides of
+        overrides are included without walking the hierarchy class by class.
+        Rows are written when a file's symbols are saved to the cache.
+
+        Args:
+            function_name: Name of the virtual method
+            class_name: Optional class name to disambiguate methods
+            project_only: When True (default), only return overrides in project files
+
+        Returns:
+            Dictionary with:
+                - method: Qualified names of the matched methods
+                - overrides: Overriding methods (qualified name, kind, location)
+                  with "overrides", the methods of the queried hierarchy each one
+                  directly overrides
+                - total: Number of overrides
+        """
+        args = (function_name, class_name, project_only)
+        return self._cached("find_overrides", args, lambda: self._find_overrides(*args))
+
+    def _find_overrides(
+        self, function_name: str, class_name: str, project_only: bool
+    ) -> Dict[str, Any]:
+        target_functions = self.query_engine.search_functions(
+            function_name, project_only=False, class_name=class_name
+        )
+        target_usrs = self._collect_target_usrs(target_functions)
+        edges = self.call_graph_analyzer.get_overriding_methods(target_usrs)
+        symbols = self.symbol_store.get_symbols_by_usrs({usr for edge in edges for usr in edge})
+
+        direct_bases: Dict[str, List[str]] = {}
+        for usr, base_usr in edges:
+            name = self._method_display_name(symbols.get(base_usr), base_usr)
+            direct_bases.setdefault(usr, []).append(name)
+        overrides = []
+        for usr, bases in direct_bases.items():
+            entry = self._function_entry(symbols.get(usr), usr, project_only)
+            if entry is not None:
+                entry["overrides"] = sorted(bases)
+                overrides.append(entry)
+        overrides.sort(key=lambda o: (o.get("file", ""), o.get("line", 0), o["qualified_name"]))
+
+        return {
+            "method": sorted(
+                {f.get("qualified_name") or f.get("name", "") for f in target_functions}
+            ),
+            "overrides": overrides,
+            "total": len(overrides),
+            "_function_found": len(target_usrs) > 0,
+        }
+
+    def find_template_call_sites(self, type_name: str, function_name: str = "") -> Dict[str, Any]:
+        """
+        Find calls to external templates instantiated with a project type.
+
+        Answers "where is std::make_shared<Sensor> called" from the template
+        type index instead of decoding template_project_types on every call site.
+
+        Args:
+            type_name: Project type used as a template argument, qualified
+                ("app::Sensor") or unqualified ("Sensor")
+            function_name: Optional callee filter ("make_shared" or
+                "std::make_shared"); empty matches every template callee
+
+        Returns:
+            Dictionary with template_type, function, call_sites (caller, location,
+            callee display name and template types) and total
+        """
+        args = (type_name, function_name)
+        return self._cached(
+            "find_template_call_sites", args, lambda: self._find_template_call_sites(*args)
+        )
+
+    def _find_template_call_sites(self, type_name: str, function_name: str) -> Dict[str, Any]:
+        matches = []
+        for call_site in self.call_graph_analyzer.get_call_sites_for_template_type(type_name):
+            callee = (call_site.display_name or "").split("<", 1)[0]
+            if function_name and not (
+                callee == function_name or callee.endswith("::" + function_name)
+            ):
+                continue
+            matches.append(call_site)
+
+        callers = self.symbol_store.get_symbols_by_usrs({cs.caller_usr for cs in matches})
+        call_sites = []
+        for call_site in matches:
+            caller_info = callers.get(call_site.caller_usr)
+            try:
+                tmpl_types = json.loads(call_site.template_project_types)
+            except (json.JSONDecodeError, TypeError):
+                tmpl_types = []
+            call_sites.append(
+                {
+                    "caller": (
+                        (caller_info.qualified_name or caller_info.name)
+                        if caller_info is not None
+                        else usr_to_display_name(call_site.caller_usr)
+                    ),
+                    "file": call_site.file,
+                    "line": call_site.line,
+                    "column": call_site.column,
+                    "target": call_site.display_name,
+                    "template_types": tmpl_types,
+                }
+            )
+        return {
+            "template_type": type_name,
+            "function": function_name or None,
+            "call_sites": call_sites,
+            "total": len(call_sites),
+        }
+
     # ------------------------------------------------------------------
     # Internal helpers
     # ------------------------------------------------------------------
 
+    def _overridden_methods(self, usrs: Set[str]) -> Set[str]:
+        """Base class methods the given methods override, transitively.
+
+        method_overrides in SQLite answers the whole chain in one recursive query;
+        symbols parsed in this session and not saved yet are followed through their
+        overridden_usrs, and SQLite is asked again for the bases found that way.
+        """
+        seen = set(usrs)
+        frontier = set(usrs)
+        while frontier:
+            infos = self.symbol_store.get_symbols_by_usrs(frontier)
+            found = self.call_graph_analyzer.get_overridden_methods(frontier)
+            found.update(base for info in infos.values() for base in info.overridden_usrs)
+            frontier = found - seen
+            seen |= frontier
+        return seen - set(usrs)
+
+    @staticmethod
+    def _method_display_name(info: Any, usr: str) -> str:
+        """Class::method name of a method, decoded from its USR when not indexed."""
+        if info is None:
+            return usr_to_display_name(usr)
+        return info.qualified_name or (
+            f"{info.parent_class}::{info.name}" if info.parent_class else info.name
+        )
+
     def _collect_target_usrs(self, target_functions: List[Dict[str, Any]]) -> Set[str]:
         """Collect USRs for target functions by matching file/line metadata."""
         target_usrs = set()
@@ -261,11 +791,69 @@ class CallGraphService:
                     target_usrs.add(symbol.usr)
         return target_usrs
 
+    def _reachable(
+        self, start_usrs: Set[str], max_depth: int, max_nodes: int, reverse: bool
+    ) -> Tuple[Dict[str, int], bool]:
+        """Map USRs within max_depth calls of start_usrs to their distance (starts excluded).
+
+        Runs over the CSR snapshot when a current one exists, else level by
+        level over call_sites in SQLite, else level by level over the analyzer
+        (session call sites not yet in SQLite).
+        """
+        if not start_usrs:
+            return {}, False
+
+        snapshot = self.call_graph_snapshot(build=False)
+        if snapshot is not None:
+            depths, truncated = snapshot.reachable_depths(
+                start_usrs, max_depth, reverse, max_nodes
+            )
+        else:
+            backend = self.cache_manager.backend if self.cache_manager else None
+            rows = None
+            if backend is not None and not self.call_graph_analyzer.call_sites:
+                rows = backend.get_reachable_usrs(
+                    sorted(start_usrs), max_depth, reverse, max_nodes + 1
+                )
+            if rows is not None:
+                truncated = len(rows) > max_nodes
+                return dict(rows[:max_nodes]), truncated
+            analyzer = self.call_graph_analyzer
+            neighbors = analyzer.find_incoming_calls if reverse else analyzer.find_callees
+            depths, truncated = reachable_depths(start_usrs, neighbors, max_depth, max_nodes)
+
+        return {usr: d for usr, d in depths.items() if d > 0}, truncated
+
+    def _function_entry(
+        self, info: Any, usr: str, project_only: bool
+    ) -> Optional[Dict[str, Any]]:
+        """Compact entry (name, kind, location) for a traversed function, or None if filtered."""
+        if info is not None:
+            if project_only and not info.is_project:
+                return None
+            locations = build_location_objects(info)
+            location = locations.get("definition") or locations.get("declaration") or {}
+            return omit_empty(
+                {
+                    "qualified_name": info.qualified_name or info.name,
+                    "kind": info.kind,
+                    "file": location.get("file"),
+                    "line": location.get("line"),
+                    "is_project": info.is_project,
+                }
+            )
+        if project_only:
+            return None
+        return {"qualified_name": usr_to_display_name(usr), "is_project": False}
+
     def _add_caller(
-        self, caller_usr: str, callers_list: List[Dict[str, Any]], project_only: bool
+        self,
+        caller_info: Any,
+        caller_usr: str,
+        callers_list: List[Dict[str, Any]],
+        project_only: bool,
     ) -> None:
-        """Add a single caller to the callers list, respecting project_only filter."""
-        caller_info = self.symbol_store.get_symbol_by_usr(caller_usr)
+        """Add a single caller (caller_info: its resolved SymbolInfo or None) to callers_list."""
         if caller_info is not None:
             callers_list.append(
                 omit_empty(
@@ -280,22 +868,21 @@ class CallGraphService:
                 )
             )
         elif not project_only:
-            rich = self.symbol_store.resolve_symbol_info(caller_usr)
-            if rich is not None:
-                callers_list.append(rich)
-            else:
-                callers_list.append(
-                    {
-                        "qualified_name": usr_to_display_name(caller_usr),
-                        "is_project": False,
-                    }
-                )
+            callers_list.append(
+                {
+                    "qualified_name": usr_to_display_name(caller_usr),
+                    "is_project": False,
+                }
+            )
 
     def _add_call_site(
-        self, call_site, call_sites_list: List[Dict[str, Any]], project_only: bool
+        self,
+        caller_info: Any,
+        call_site: Any,
+        call_sites_list: List[Dict[str, Any]],
+        project_only: bool,
     ) -> None:
         """Add a single call site to the call sites list, respecting project_only filter."""
-        caller_info = self.symbol_store.get_symbol_by_usr(call_site.caller_usr)
         if caller_info is not None:
             call_sites_list.append(
                 {
@@ -317,10 +904,8 @@ class CallGraphService:
                 }
             )
 
-    def _build_call_site_entry(self, call_site: Any) -> Dict[str, Any]:
+    def _build_call_site_entry(self, target_info: Any, call_site: Any) -> Dict[str, Any]:
         """Build a call site entry for a callee that exists in the project index."""
-        target_info = self.symbol_store.get_symbol_by_usr(call_site.callee_usr)
-        assert target_info is not None
         entry: Dict[str, Any] = {
             "target": target_info.name,
             "target_signature": target_info.signature,
@@ -358,13 +943,17 @@ class CallGraphService:
 
     def _add_callee(
         self,
+        callee_info: Any,
         callee_usr: str,
         callees_list: List[Dict[str, Any]],
         project_only: bool,
-        target_usrs: Set[str],
+        template_site: Any = None,
     ) -> None:
-        """Add a single callee to the callees list, respecting project_only filter."""
-        callee_info = self.symbol_store.get_symbol_by_usr(callee_usr)
+        """Add a single callee to the callees list, respecting project_only filter.
+
+        callee_info is the callee's resolved SymbolInfo (or None); template_site
+        is its first call site carrying template metadata, if any.
+        """
         if callee_info is not None:
             callees_list.append(
                 omit_empty(
@@ -380,22 +969,17 @@ class CallGraphService:
             )
             return
 
-        tmpl_info = self._get_template_mediated_info(target_usrs, callee_usr)
-        if tmpl_info:
-            callees_list.append(tmpl_info)
+        if template_site is not None:
+            callees_list.append(self._template_mediated_info(template_site, callee_usr))
             return
 
         if not project_only:
-            rich = self.symbol_store.resolve_symbol_info(callee_usr)
-            if rich is not None:
-                callees_list.append(rich)
-            else:
-                callees_list.append(
-                    {
-                        "qualified_name": usr_to_display_name(callee_usr),
-                        "is_project": False,
-                    }
-                )
+            callees_list.append(
+                {
+                    "qualified_name": usr_to_display_name(callee_usr),
+                    "is_project": False,
+                }
+            )
 
     def _get_usrs_for_functions(self, funcs: List[Dict[str, Any]]) -> set:
         """Resolve a list of function search results to a set of USRs."""
@@ -412,60 +996,45 @@ class CallGraphService:
         return usrs
 
     def _find_paths_bfs(self, from_usrs: set, to_usrs: set, max_depth: int) -> List[List[str]]:
-        """Perform BFS to find paths between sets of USRs."""
-        paths = []
-        for from_usr in from_usrs:
-            queue = [(from_usr, [from_usr])]
-            visited = {from_usr}
-            depth = 0
-
-            while queue and depth < max_depth:
-                next_queue = []
-                for current_usr, path in queue:
-                    if current_usr in to_usrs:
-                        name_path = []
-                        for usr in path:
-                            info = self.symbol_store.get_symbol_by_usr(usr)
-                            if info is not None:
-                                name_path.append(
-                                    f"{info.parent_class}::{info.name}"
-                                    if info.parent_class
-                                    else info.name
-                                )
-                        paths.append(name_path)
-                        continue
-
-                    for callee_usr in self.call_graph_analyzer.find_callees(current_usr):
-                        if callee_usr not in visited:
-                            visited.add(callee_usr)
-                            next_queue.append((callee_usr, path + [callee_usr]))
-
-                queue = next_queue
-                depth += 1
+        """Find the shortest call paths between sets of USRs (bidirectional BFS + Yen).
+
+        Paths have at most max_depth - 1 calls.  At most max_call_paths paths
+        are returned, shortest first; the search stops early when the node
+        budget or timeout is spent.
+        """
+        callees_of, callers_of = self._neighbor_lookups()
+        budget = SearchBudget(self.path_node_budget, self.path_timeout_ms)
+        usr_paths = find_call_paths(
+            from_usrs, to_usrs, callees_of, callers_of, max_depth - 1, self.max_call_paths, budget
+        )
+        if budget.exhausted:
+            diagnostics.debug(
+                f"Call path search stopped at its budget with {len(usr_paths)} path(s)"
+            )
 
+        paths = []
+        for path in usr_paths:
+            name_path = []
+            for usr in path:
+                info = self.symbol_store.get_symbol_by_usr(usr)
+                if info is not None:
+                    name_path.append(
+                        f"{info.parent_class}::{info.name}" if info.parent_class else info.name
+                    )
+            paths.append(name_path)
         return paths
 
-    def _get_template_mediated_info(
-        self, target_usrs: set, callee_usr: str
-    ) -> Optional[Dict[str, Any]]:
-        """Check if a callee has template-mediated project type relevance.
+    @staticmethod
+    def _template_mediated_info(call_site: Any, callee_usr: str) -> Dict[str, Any]:
+        """Result entry for an external callee called with project template arguments.
 
         When an external template function (e.g. std::make_shared) is called with a
-        project type as a template argument, this returns a result dict that surfaces
-        the call even when project_only=True.
-
-        Returns None if no project-type template args are found.
+        project type as a template argument, the call is surfaced even when
+        project_only=True.
         """
-        backend = self.cache_manager.backend
-        if backend is None or not hasattr(backend, "get_template_mediated_call_sites"):
-            return None
-        rows = backend.get_template_mediated_call_sites(list(target_usrs), callee_usr)
-        if not rows:
-            return None
-        row = rows[0]
-        display_name = row.get("display_name") or usr_to_display_name(callee_usr)
+        display_name = call_site.display_name or usr_to_display_name(callee_usr)
         try:
-            project_types = json.loads(row["template_project_types"])
+            project_types = json.loads(call_site.template_project_types)
         except (json.JSONDecodeError, TypeError):
             project_types = []
         return {
@@ -0,0 +1,197 @@
+"""Immutable compressed sparse row (CSR) snapshot of the call graph.
+
+Multi-hop traversals (call paths, reachability) would otherwise issue one
+SQLite query per visited function.  CallGraphSnapshot holds the whole call
+graph as four flat uint32 arrays over dense node ids:
+
+    fwd_offsets[n] .. fwd_offsets[n + 1]  -> slice of fwd_targets (callees of n)
+    rev_offsets[n] .. rev_offsets[n + 1]  -> slice of rev_targets (callers of n)
+
+Snapshots are built from the call_sites table (see
+CallSiteRepository.load_call_edges), saved to the cache directory and
+memory-mapped on load, so a restart does not rebuild them.  Each snapshot
+records the call_sites fingerprint it was built from; a snapshot whose
+fingerprint no longer matches the database is stale.  The fingerprint starts
+with an id drawn when the database was created, so a snapshot left over from
+a deleted and recreated database never matches.
+"""
+
+import mmap
+import os
+import struct
+from array import array
+from collections import deque
+from pathlib import Path
+from typing import Dict, Iterable, List, Optional, Sequence, Set, Tuple
+
+from .._core import diagnostics
+
+# magic, format version, fingerprint (database id, row count, max row id),
+# node count, edge count
+_HEADER = struct.Struct("<4sIQQQII")
+_MAGIC = b"CSRG"
+_FORMAT_VERSION = 2
+
+Fingerprint = Tuple[int, int, int]
+
+
+def _csr(node_count: int, edges: List[Tuple[int, int]]) -> Tuple[array, array]:
+    """Build (offsets, targets) for edges sorted by source node."""
+    offsets = array("I", bytes(4 * (node_count + 1)))
+    for source, _ in edges:
+        offsets[source + 1] += 1
+    for node in range(node_count):
+        offsets[node + 1] += offsets[node]
+    return offsets, array("I", (target for _, target in edges))
+
+
+class CallGraphSnapshot:
+    """Forward and reverse CSR adjacency over the call graph."""
+
+    def __init__(
+        self,
+        usrs: List[str],
+        arrays: Sequence[Sequence[int]],
+        fingerprint: Fingerprint,
+    ):
+        """
+        Args:
+            usrs: USR of each node id.
+            arrays: fwd_offsets, fwd_targets, rev_offsets, rev_targets.
+            fingerprint: call_sites fingerprint the snapshot was built from.
+        """
+        self.usrs = usrs
+        self.fwd_offsets, self.fwd_targets, self.rev_offsets, self.rev_targets = arrays
+        self.fingerprint = fingerprint
+        self._ids: Dict[str, int] = {usr: node for node, usr in enumerate(usrs)}
+
+    @property
+    def node_count(self) -> int:
+        return len(self.usrs)
+
+    @property
+    def edge_count(self) -> int:
+        return len(self.fwd_targets)
+
+    @classmethod
+    def build(
+        cls,
+        usr_rows: Iterable[Tuple[int, str]],
+        edges: Iterable[Tuple[int, int]],
+        fingerprint: Fingerprint,
+    ) -> "CallGraphSnapshot":
+        """Build a snapshot from (usr_id, usr) rows and (caller_id, callee_id) edges."""
+        usrs: List[str] = []
+        dense: Dict[int, int] = {}
+        for usr_id, usr in sorted(usr_rows):
+            dense[usr_id] = len(usrs)
+            usrs.append(usr)
+
+        forward = sorted({(dense[caller], dense[callee]) for caller, callee in edges})
+        reverse = sorted((callee, caller) for caller, callee in forward)
+        fwd_offsets, fwd_targets = _csr(len(usrs), forward)
+        rev_offsets, rev_targets = _csr(len(usrs), reverse)
+        return cls(usrs, (fwd_offsets, fwd_targets, rev_offsets, rev_targets), fingerprint)
+
+    def save(self, path: Path) -> None:
+        """Write the snapshot to path (atomically, via a temporary file)."""
+        tmp_path = path.with_name(path.name + ".tmp")
+        with open(tmp_path, "wb") as f:
+            f.write(
+                _HEADER.pack(
+                    _MAGIC,
+                    _FORMAT_VERSION,
+                    *self.fingerprint,
+                    self.node_count,
+                    self.edge_count,
+                )
+            )
+            for values in (self.fwd_offsets, self.fwd_targets, self.rev_offsets, self.rev_targets):
+                f.write(array("I", values).tobytes())
+            f.write("\0".join(self.usrs).encode("utf-8"))
+        os.replace(tmp_path, path)
+
+    @classmethod
+    def load(cls, path: Path) -> Optional["CallGraphSnapshot"]:
+        """Memory-map a saved snapshot; returns None if missing or unreadable."""
+        try:
+            with open(path, "rb") as f:
+                mapped = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        except (OSError, ValueError):
+            return None
+
+        try:
+            magic, version, database_id, rows, max_id, nodes, edges = _HEADER.unpack_from(mapped)
+            if magic != _MAGIC or version != _FORMAT_VERSION:
+                return None
+            view = memoryview(mapped)
+            arrays = []
+            offset = _HEADER.size
+            for length in (nodes + 1, edges, nodes + 1, edges):
+                arrays.append(view[offset : offset + 4 * length].cast("I"))
+                offset += 4 * length
+            blob = bytes(view[offset:]).decode("utf-8")
+            usrs = blob.split("\0") if nodes else []
+            if len(usrs) != nodes:
+                return None
+        except (struct.error, TypeError, ValueError, UnicodeDecodeError) as e:
+            diagnostics.debug(f"Ignoring unreadable call graph snapshot {path}: {e}")
+            return None
+        return cls(usrs, arrays, (database_id, rows, max_id))
+
+    def contains(self, usr: str) -> bool:
+        return usr in self._ids
+
+    def callees(self, usr: str) -> List[str]:
+        """USRs called by usr."""
+        return self._neighbors(usr, self.fwd_offsets, self.fwd_targets)
+
+    def callers(self, usr: str) -> List[str]:
+        """USRs calling usr."""
+        return self._neighbors(usr, self.rev_offsets, self.rev_targets)
+
+    def reachable(
+        self, from_usrs: Iterable[str], max_depth: int, reverse: bool = False
+    ) -> Set[str]:
+        """USRs within max_depth calls of from_usrs, start nodes included (callers if reverse)."""
+        return set(self.reachable_depths(from_usrs, max_depth, reverse)[0])
+
+    def reachable_depths(
+        self,
+        from_usrs: Iterable[str],
+        max_depth: int,
+        reverse: bool = False,
+        max_nodes: Optional[int] = None,
+    ) -> Tuple[Dict[str, int], bool]:
+        """Map USRs within max_depth calls of from_usrs to their call distance.
+
+        Start nodes map to 0.  The traversal stops once max_nodes functions
+        besides the start nodes were reached; the second value is True when
+        that cut off part of the result.
+        """
+        if reverse:
+            offsets, targets = self.rev_offsets, self.rev_targets
+        else:
+            offsets, targets = self.fwd_offsets, self.fwd_targets
+        depths = {self._ids[usr]: 0 for usr in from_usrs if usr in self._ids}
+        limit = len(depths) + max_nodes if max_nodes is not None else None
+        queue = deque(depths)
+        while queue:
+            node = queue.popleft()
+            depth = depths[node]
+            if depth >= max_depth:
+                continue
+            for target in targets[offsets[node] : offsets[node + 1]]:
+                if target in depths:
+                    continue
+                if limit is not None and len(depths) >= limit:
+                    return {self.usrs[n]: d for n, d in depths.items()}, True
+                depths[target] = depth + 1
+                queue.append(target)
+        return {self.usrs[n]: d for n, d in depths.items()}, False
+
+    def _neighbors(self, usr: str, offsets: Sequence[int], targets: Sequence[int]) -> List[str]:
+        node = self._ids.get(usr)
+        if node is None:
+            return []
+        return [self.usrs[target] for target in targets[offsets[node] : offsets[node + 1]]]
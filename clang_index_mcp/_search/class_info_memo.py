@@ -0,0 +1,88 @@
+"""Materialized get_class_info payloads, kept per class USR.
+
+Assembling a class payload scans the function index for the class's methods,
+builds their prototypes and sorts them.  Agents ask for the same classes over
+and over, so ClassInfoMemo keeps each payload until one of the files it was
+built from (the class, its methods, its primary template) is re-indexed, or a
+changed file declares a class or method under the class's simple name (an
+out-of-line method in a new file, a richer definition of the class).
+
+Payloads are stored pickled, like QueryResultCache entries, so every caller
+gets a private copy.
+"""
+
+import pickle
+from collections import defaultdict
+from typing import Any, Dict, Iterable, Optional, Set
+
+from .._symbols.inheritance_index import base_key
+from .._symbols.model import CLASS_KINDS, SymbolInfo
+
+
+def owner_names(symbol: SymbolInfo) -> Set[str]:
+    """Simple names of the classes whose payload a symbol may belong to."""
+    if symbol.kind in CLASS_KINDS:
+        return {base_key(symbol.name)}
+    names = set()
+    if symbol.parent_class:
+        names.add(base_key(symbol.parent_class))
+    if symbol.qualified_name and "::" in symbol.qualified_name:
+        names.add(base_key(symbol.qualified_name.rsplit("::", 1)[0]))
+    return names
+
+
+class ClassInfoMemo:
+    """get_class_info payloads by class USR (see module docstring)."""
+
+    def __init__(self) -> None:
+        self.generation = -1
+        self.file_version: Optional[int] = None
+        self._payloads: Dict[str, bytes] = {}
+        # File / simple class name -> USRs of the payloads depending on it
+        self._usrs_by_file: Dict[str, Set[str]] = defaultdict(set)
+        self._usrs_by_name: Dict[str, Set[str]] = defaultdict(set)
+
+    def sync(self, symbol_store) -> None:
+        """Drop payloads built from files changed since the last sync (call under index_lock)."""
+        generation = symbol_store.generation
+        if generation == self.generation:
+            return
+        files = None
+        if self.file_version is not None:
+            files = symbol_store.get_files_changed_since(self.file_version)
+        if isinstance(files, set):
+            for file_path in files:
+                self._drop(self._usrs_by_file.pop(file_path, ()))
+                for symbol in symbol_store.get_symbols_in_file(file_path):
+                    for name in owner_names(symbol):
+                        self._drop(self._usrs_by_name.pop(name, ()))
+        else:
+            self._payloads = {}
+            self._usrs_by_file = defaultdict(set)
+            self._usrs_by_name = defaultdict(set)
+        self.generation = generation
+        self.file_version = symbol_store.file_change_version()
+
+    def _drop(self, usrs: Iterable[str]) -> None:
+        for usr in usrs:
+            self._payloads.pop(usr, None)
+
+    def get(self, usr: str) -> Optional[Dict[str, Any]]:
+        payload = self._payloads.get(usr)
+        return None if payload is None else pickle.loads(payload)
+
+    def put(self, info: SymbolInfo, payload: Dict[str, Any], files: Set[str]) -> None:
+        """Keep the payload of a class (with a USR), built from the symbols of files."""
+        usr = info.usr
+        assert usr
+        self._payloads[usr] = pickle.dumps(payload, protocol=pickle.HIGHEST_PROTOCOL)
+        for file_path in files:
+            if file_path:
+                self._usrs_by_file[file_path].add(usr)
+        names = owner_names(info)
+        names.add(base_key(info.qualified_name or info.name))
+        for name in names:
+            self._usrs_by_name[name].add(usr)
+
+    def __len__(self) -> int:
+        return len(self._payloads)
@@ -0,0 +1,99 @@
+"""Snapshot of the function symbols of function_index, caught up incrementally.
+
+The signature token index and the parallel search shards keep their own
+structures over every function in function_index.  FunctionSnapshot numbers
+those functions and, when the store changes, appends the functions added
+since the last sync (from the journal of the store's function namespace tree)
+instead of starting over.
+
+Removed functions are not unlinked: their numbers stay behind and are dropped
+when matches are put back into index order (in_index_order), which asks the
+namespace tree where each match sits in function_index.  The snapshot starts
+over once the removed functions outnumber half of it.
+"""
+
+from typing import TYPE_CHECKING, Iterable, List, Optional, Tuple
+
+from .._symbols.model import FUNCTION_KINDS, SymbolInfo
+
+if TYPE_CHECKING:
+    from .._symbols.symbol_index_store import SymbolIndexStore
+
+
+class FunctionSnapshot:
+    """Function symbols of function_index by position (see module docstring)."""
+
+    def __init__(self) -> None:
+        self.functions: List[SymbolInfo] = []
+        self.generation: Optional[int] = None
+        self._version: Optional[int] = None
+        # Functions removed from the index since the last rebuild
+        self._removed = 0
+        # Whether functions were appended since the last rebuild (positions
+        # no longer follow index order)
+        self._appended = False
+
+    def sync(self, store: "SymbolIndexStore") -> Optional[int]:
+        """Catch up with the store (call under index_lock).
+
+        Returns:
+            The position of the first function appended by this sync (the
+            length of the snapshot if nothing was added), or None if the
+            snapshot was rebuilt from function_index.
+        """
+        start = len(self.functions)
+        if self.generation == store.generation:
+            return start
+        _, tree = store.get_namespace_trees()
+        changes = None if self._version is None else tree.changes_since(self._version)
+        if changes is not None and self._removed + len(changes.removed) <= start // 2:
+            self._removed += len(changes.removed)
+            self.functions.extend(info for info in changes.added if info.kind in FUNCTION_KINDS)
+            self._appended = self._appended or len(self.functions) > start
+        else:
+            self.functions = [
+                info
+                for infos in store.function_index.values()
+                for info in infos
+                if info.kind in FUNCTION_KINDS
+            ]
+            self._removed = 0
+            self._appended = False
+            start = None
+        self.generation = store.generation
+        self._version = tree.version
+        return start
+
+    def in_index_order(
+        self, store: "SymbolIndexStore", positions: Iterable[int]
+    ) -> List[SymbolInfo]:
+        """Return the functions at positions that are still indexed, in function_index order.
+
+        Call under index_lock, with the snapshot synced.
+        """
+        functions = self.functions
+        if not self._removed and not self._appended:
+            return [functions[pos] for pos in sorted(positions)]
+
+        _, tree = store.get_namespace_trees()
+        ordered: List[Tuple[Tuple[int, int], int]] = []
+        for pos in positions:
+            order = tree.scan_order(functions[pos])
+            if order is not None:
+                ordered.append((order, pos))
+        ordered.sort()
+        result: List[SymbolInfo] = []
+        last = None
+        for order, pos in ordered:
+            # A function removed and added again appears twice
+            if order != last:
+                result.append(functions[pos])
+                last = order
+        return result
+
+    def clear(self) -> None:
+        self.functions = []
+        self.generation = None
+        self._version = None
+        self._removed = 0
+        self._appended = False
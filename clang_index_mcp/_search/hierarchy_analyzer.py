@@ -3,19 +3,106 @@
 Encapsulates resolving base-class keys, looking up class infos, and BFS traversal
 for ``get_class_hierarchy`` so that the QueryEngine class does not need to own all
 of this logic.
+
+Base-key resolutions and per-node data only change when the index does, so a
+HierarchyMemo keeps them for the current index generation: raw base names such
+as ``QObject`` repeat across thousands of classes, and repeated hierarchy
+queries then cost in proportion to the classes they return.  When classes
+change, only the entries that depend on the changed class names are dropped.
+
+Given the inheritance closure of the query engine, node data takes the
+derived classes from the closure's resolved edges instead of searching the
+candidate subclasses of every visited class.
 """
 
-from collections import deque
-from typing import Any, Dict, List, Optional, Set, Tuple
+from collections import defaultdict, deque
+from typing import TYPE_CHECKING, Any, Dict, List, Optional, Set, Tuple
 
+from .._symbols.inheritance_index import ClassChanges, base_key, base_keys
 from .._symbols.model import SymbolInfo
 from .._search.pattern_matcher import matches_qualified_pattern
 from .._search.symbol_name_utils import extract_simple_name, strip_template_args
 from .._search.template_analyzer import get_derived_classes
 
+if TYPE_CHECKING:
+    from .._search.inheritance_closure import InheritanceClosure
+
+
+class HierarchyMemo:
+    """Base-key resolutions and hierarchy node data for one index generation."""
+
+    def __init__(self) -> None:
+        self.generation = -1
+        self.class_version: Optional[int] = None
+        self.base_keys: Dict[str, str] = {}
+        self.nodes: Dict[str, Dict[str, Any]] = {}
+        # Simple class name -> raw base names / node keys depending on it
+        self._raws_by_name: Dict[str, Set[str]] = defaultdict(set)
+        self._nodes_by_name: Dict[str, Set[str]] = defaultdict(set)
+
+    def sync(self, symbol_store) -> None:
+        """Drop the entries of an older index generation (call under index_lock).
+
+        Entries that do not depend on a class changed since then are kept.
+        """
+        generation = symbol_store.generation
+        if generation == self.generation:
+            return
+        changes = None
+        if self.class_version is not None:
+            changes = symbol_store.get_class_changes_since(self.class_version)
+        if isinstance(changes, ClassChanges):
+            self._invalidate(changes, symbol_store)
+        else:
+            self.base_keys = {}
+            self.nodes = {}
+            self._raws_by_name = defaultdict(set)
+            self._nodes_by_name = defaultdict(set)
+        self.generation = generation
+        self.class_version = symbol_store.class_change_version()
+
+    def _invalidate(self, changes: ClassChanges, symbol_store) -> None:
+        # A raw base name resolves against the classes with its simple name
+        for name in changes.names:
+            for raw in self._raws_by_name.pop(name, ()):
+                self.base_keys.pop(raw, None)
+        # A node lists its class, its bases and its derived classes.  Derived
+        # classes through a template parameter (Foo<Bar> : T) depend on the
+        # template too, so classes naming a changed class affect their bases.
+        node_names = changes.names | changes.base_names
+        for name in changes.names:
+            for info in symbol_store.get_derived_class_candidates(name):
+                node_names |= base_keys(info)
+        for name in node_names:
+            for key in self._nodes_by_name.pop(name, ()):
+                self.nodes.pop(key, None)
+
+    def add_base_key(self, raw: str, key: str) -> None:
+        self.base_keys[raw] = key
+        self._raws_by_name[base_key(raw)].add(raw)
 
-def resolve_base_key(raw: str, symbol_store, index_lock) -> str:
+    def add_node(self, key: str, node: Dict[str, Any]) -> None:
+        self.nodes[key] = node
+        for name in [key] + node["base_classes"]:
+            self._nodes_by_name[base_key(name)].add(key)
+
+
+def resolve_base_key(
+    raw: str, symbol_store, index_lock, memo: Optional[HierarchyMemo] = None
+) -> str:
     """Resolve a raw base-class name to a canonical key (qualified name)."""
+    if memo is None:
+        return _resolve_base_key(raw, symbol_store, index_lock)
+    with index_lock:
+        memo.sync(symbol_store)
+        key = memo.base_keys.get(raw)
+        if key is None:
+            key = _resolve_base_key(raw, symbol_store, index_lock)
+            memo.add_base_key(raw, key)
+        return key
+
+
+def _resolve_base_key(raw: str, symbol_store, index_lock) -> str:
     is_dependent = raw.startswith("typename ") or (
         "<" in raw and ">" in raw and not raw.endswith(">")
     )
@@ -62,8 +149,38 @@ def collect_hierarchy_node_data(
     key: str,
     symbol_store,
     index_lock,
+    memo: Optional[HierarchyMemo] = None,
+    closure: Optional["InheritanceClosure"] = None,
 ) -> Optional[Dict[str, Any]]:
-    """Collect class node data for hierarchy building. Returns None if not found."""
+    """Collect class node data for hierarchy building. Returns None if not found.
+
+    Args:
+        closure: Inheritance closure of the current index generation, if
+            any, to read derived classes from.
+    """
+    if memo is None:
+        return _collect_hierarchy_node_data(key, symbol_store, index_lock, None, closure)
+    with index_lock:
+        memo.sync(symbol_store)
+        node = memo.nodes.get(key)
+        if node is None:
+            node = _collect_hierarchy_node_data(key, symbol_store, index_lock, memo, closure)
+            memo.add_node(key, node)
+    # Callers own the returned node and its lists
+    return {
+        **node,
+        "base_classes": list(node["base_classes"]),
+        "derived_classes": list(node["derived_classes"]),
+    }
+
+
+def _collect_hierarchy_node_data(
+    key: str,
+    symbol_store,
+    index_lock,
+    memo: Optional[HierarchyMemo],
+    closure: Optional["InheritanceClosure"],
+) -> Dict[str, Any]:
     infos = lookup_class_infos(key, symbol_store, index_lock)
     if not infos:
         # Unresolved: external lib or template-dependent name
@@ -90,22 +207,25 @@ def collect_hierarchy_node_data(
     base_keys: List[str] = []
     seen_base: Set[str] = set()
     for raw_base in info.base_classes:
-        bk = resolve_base_key(raw_base, symbol_store, index_lock)
+        bk = resolve_base_key(raw_base, symbol_store, index_lock, memo)
         if bk not in seen_base:
             seen_base.add(bk)
             base_keys.append(bk)
 
     # Get derived classes for this node
-    derived = get_derived_classes(
-        info_key, project_only=False, symbol_store=symbol_store, index_lock=index_lock
-    )
     derived_keys: List[str] = []
-    seen_derived: Set[str] = set()
-    for d in derived:
-        dk = d["qualified_name"]
-        if dk not in seen_derived:
-            seen_derived.add(dk)
-            derived_keys.append(dk)
+    if closure is not None:
+        derived_keys = closure.derived_classes(info_key)
+    else:
+        derived = get_derived_classes(
+            info_key, project_only=False, symbol_store=symbol_store, index_lock=index_lock
+        )
+        seen_derived: Set[str] = set()
+        for d in derived:
+            dk = d["qualified_name"]
+            if dk not in seen_derived:
+                seen_derived.add(dk)
+                derived_keys.append(dk)
 
     return {
         "qualified_name": info_key,
@@ -137,6 +257,8 @@ def bfs_traverse_hierarchy(
     symbol_store,
     index_lock,
     initial_visited: Optional[Set[str]] = None,
+    memo: Optional[HierarchyMemo] = None,
+    closure: Optional["InheritanceClosure"] = None,
 ) -> Tuple[Set[str], bool]:
     """Perform BFS traversal in specified direction for class hierarchy.
     Returns (set of visited keys, truncated flag).
@@ -152,7 +274,9 @@ def bfs_traverse_hierarchy(
             continue
         visited.add(current)
 
-        node_data = collect_hierarchy_node_data(current, symbol_store, index_lock)
+        node_data = collect_hierarchy_node_data(
+            current, symbol_store, index_lock, memo, closure
+        )
         if node_data is None:
             continue
 
@@ -184,8 +308,16 @@ def get_class_hierarchy(
     direction: str,
     symbol_store,
     index_lock,
+    memo: Optional[HierarchyMemo] = None,
+    closure: Optional["InheritanceClosure"] = None,
 ) -> Dict[str, Any]:
-    """Get the inheritance graph for a class as a flat adjacency list."""
+    """Get the inheritance graph for a class as a flat adjacency list.
+
+    Args:
+        memo: Optional memo reused across queries of the same index generation.
+        closure: Optional inheritance closure of the current index generation;
+            derived classes are read from it.
+    """
     if direction not in ("up", "down", "both"):
         return {"error": f"Invalid direction '{direction}'. Must be one of: up, down, both"}
 
@@ -198,30 +330,29 @@ def get_class_hierarchy(
     classes: Dict[str, Any] = {}
     truncated = False
 
-    if direction == "up":
-        _, truncated = bfs_traverse_hierarchy(
-            start_key, "up", max_depth, max_nodes, classes, symbol_store, index_lock
+    def walk(towards: str, initial_visited: Optional[Set[str]] = None) -> Tuple[Set[str], bool]:
+        return bfs_traverse_hierarchy(
+            start_key,
+            towards,
+            max_depth,
+            max_nodes,
+            classes,
+            symbol_store,
+            index_lock,
+            initial_visited=initial_visited,
+            memo=memo,
+            closure=closure,
         )
+
+    if direction == "up":
+        _, truncated = walk("up")
     elif direction == "down":
-        _, truncated = bfs_traverse_hierarchy(
-            start_key, "down", max_depth, max_nodes, classes, symbol_store, index_lock
-        )
+        _, truncated = walk("down")
     else:  # both
-        v_up, trunc_up = bfs_traverse_hierarchy(
-            start_key, "up", max_depth, max_nodes, classes, symbol_store, index_lock
-        )
+        v_up, trunc_up = walk("up")
         trunc_down = False
         if max_nodes is None or len(classes) < max_nodes:
-            _, trunc_down = bfs_traverse_hierarchy(
-                start_key,
-                "down",
-                max_depth,
-                max_nodes,
-                classes,
-                symbol_store,
-                index_lock,
-                initial_visited=v_up,
-            )
+            _, trunc_down = walk("down", initial_visited=v_up)
         truncated = trunc_up or trunc_down
 
     result: Dict[str, Any] = {
@@ -0,0 +1,536 @@
+"""Transitive inheritance closure with interval labels.
+
+The inheritance graph is numbered once per index generation by a depth-first
+walk from the root classes over base -> derived edges (post-order).  Every
+class gets the merged post-order intervals covering all of its transitive
+subclasses: a single interval for a class whose subclasses form a tree, a few
+more where multiple inheritance joins branches.  Then
+
+- "does X derive from Y" is a binary search in Y's intervals, and
+- "all subclasses of Y" reads Y's intervals, O(number of subclasses).
+
+The resolved direct edges also answer get_derived_classes, get_class_info's
+derived classes and the downward get_class_hierarchy walk, so those queries
+no longer match every candidate's bases against the class per call.
+
+Nodes are keyed like get_class_hierarchy nodes: qualified names, with base
+class names resolved by resolve_base_key() (so a base naming a template
+specialization is linked to the primary template).  Inheritance through a
+template parameter (``class Foo<T> : public T`` used as ``Foo<Bar>``) links
+the class to ``Bar`` as well.
+
+When classes change, updated() resolves the bases of the changed classes and
+of the classes naming them again and patches the labels of the affected
+subgraph only: classes added since the last full labeling are numbered after
+the others and removed ones leave their number unused, so the numbering is no
+longer a post-order and intervals fragment.  Once the intervals outnumber
+twice those of the last full labeling, or half the numbers are unused, the
+graph is labeled from scratch again.
+"""
+
+from bisect import bisect_right, insort
+from collections import Counter, defaultdict, deque
+from typing import Any, Dict, Iterable, List, Optional, Set, Tuple
+
+from .._search.hierarchy_analyzer import HierarchyMemo, lookup_class_infos, resolve_base_key
+from .._search.symbol_name_utils import strip_template_args
+from .._search.template_analyzer import (
+    build_param_name_to_index,
+    get_template_param_inheritance_indices,
+    parse_template_args,
+)
+from .._symbols.inheritance_index import ClassChanges
+from .._symbols.model import build_location_objects, omit_empty
+
+Interval = Tuple[int, int]
+
+
+def _resolved_bases(info, symbol_store, index_lock, memo: Optional[HierarchyMemo]) -> List[str]:
+    """Canonical keys of the direct bases of a class symbol."""
+    tparam_names = build_param_name_to_index(info.template_parameters)
+    keys: List[str] = []
+    for raw in info.base_classes:
+        # Bases that are the class's own template parameters are not classes
+        if raw in tparam_names:
+            continue
+        keys.append(resolve_base_key(raw, symbol_store, index_lock, memo))
+        if "<" in raw and raw.endswith(">"):
+            indices = get_template_param_inheritance_indices(
+                strip_template_args(raw), symbol_store, index_lock
+            )
+            args = parse_template_args(raw[raw.index("<") + 1 : -1])
+            for index in indices:
+                if index < len(args):
+                    keys.append(resolve_base_key(args[index], symbol_store, index_lock, memo))
+    return keys
+
+
+def _merge_intervals(intervals: Iterable[Interval]) -> List[Interval]:
+    merged: List[Interval] = []
+    for low, high in sorted(intervals):
+        if merged and low <= merged[-1][1] + 1:
+            if high > merged[-1][1]:
+                merged[-1] = (merged[-1][0], high)
+        else:
+            merged.append((low, high))
+    return merged
+
+
+class InheritanceClosure:
+    """Reachability labels of the class inheritance graph (see module docstring)."""
+
+    def __init__(
+        self,
+        bases: Dict[str, List[str]],
+        project_keys: Set[str],
+        names: Optional[Dict[str, Set[str]]] = None,
+    ):
+        """
+        Args:
+            bases: Class key -> keys of its direct bases.  Bases that are not
+                classes themselves (external or unresolved) become nodes too.
+            project_keys: Keys of project classes.
+            names: Class key -> simple names of its symbols (needed by updated()).
+        """
+        self.project_keys = project_keys
+        self.class_bases = bases
+        self.class_names: Dict[str, Set[str]] = names or {}
+        self._keys_by_name: Dict[str, Set[str]] = defaultdict(set)
+        for key, key_names in self.class_names.items():
+            for name in key_names:
+                self._keys_by_name[name].add(key)
+        self.bases: Dict[str, List[str]] = {}
+        self.derived: Dict[str, List[str]] = defaultdict(list)
+        for key in sorted(bases):
+            unique = list(dict.fromkeys(b for b in bases[key] if b != key))
+            self.bases[key] = unique
+            for base in unique:
+                self.bases.setdefault(base, [])
+                self.derived[base].append(key)
+
+        self.post: Dict[str, int] = {}
+        # Class keys by number; None for numbers of classes removed by updated()
+        self.order: List[Optional[str]] = []
+        self.intervals: Dict[str, List[Interval]] = {}
+        self._label()
+        self._interval_count = sum(len(i) for i in self.intervals.values())
+        self._labeled_interval_count = self._interval_count
+        self._unused_numbers = 0
+
+        self.depth: Dict[str, int] = dict.fromkeys(self.bases, 0)
+        for key in reversed(self.order):
+            assert key is not None
+            for child in self.derived.get(key, ()):
+                # Skip edges closing a cycle (only possible with name collisions)
+                if self.post[child] < self.post[key]:
+                    self.depth[child] = max(self.depth[child], self.depth[key] + 1)
+
+    @classmethod
+    def build(
+        cls, symbol_store, index_lock, memo: Optional[HierarchyMemo] = None
+    ) -> "InheritanceClosure":
+        """Build the closure from all indexed class symbols.
+
+        Args:
+            memo: Optional base-key memo shared with hierarchy queries.
+        """
+        bases: Dict[str, List[str]] = defaultdict(list)
+        project_keys: Set[str] = set()
+        names: Dict[str, Set[str]] = defaultdict(set)
+        with index_lock:
+            for _name, infos in symbol_store.iter_class_items():
+                for info in infos:
+                    key = info.qualified_name or info.name
+                    bases[key].extend(_resolved_bases(info, symbol_store, index_lock, memo))
+                    names[key].add(info.name)
+                    if info.is_project:
+                        project_keys.add(key)
+        return cls(dict(bases), project_keys, dict(names))
+
+    def updated(
+        self,
+        changes: ClassChanges,
+        symbol_store,
+        index_lock,
+        memo: Optional[HierarchyMemo] = None,
+    ) -> "InheritanceClosure":
+        """The closure after the given class changes (from get_class_changes_since).
+
+        Only the classes named in the changes and the classes that may derive
+        from them are resolved again.  Returns self when no class, edge or
+        project flag changed; otherwise a new closure, leaving this one intact
+        for readers still holding it.
+
+        The new closure starts from shallow copies of this one's maps; labels
+        are recomputed for the ancestors of the changed edges and depths for
+        the descendants of the changed classes, so the work in Python is
+        proportional to that subgraph.  A full relabel (O(V + E)) happens only
+        when the patched labels have fragmented (see module docstring).
+        """
+        # Affected class key -> simple names to look its symbols up by
+        affected: Dict[str, Set[str]] = defaultdict(set)
+        with index_lock:
+            for name in changes.names:
+                for key in self._keys_by_name.get(name, ()):
+                    affected[key].add(name)
+                for info in symbol_store.get_classes_by_name(name):
+                    affected[info.qualified_name or info.name].add(info.name)
+                for info in symbol_store.get_derived_class_candidates(name):
+                    affected[info.qualified_name or info.name].add(info.name)
+
+            new_bases: Dict[str, List[str]] = {}
+            new_names: Dict[str, Set[str]] = {}
+            new_project: Set[str] = set()
+            for key, key_names in affected.items():
+                for name in sorted(key_names | self.class_names.get(key, set())):
+                    for info in symbol_store.get_classes_by_name(name):
+                        if (info.qualified_name or info.name) != key:
+                            continue
+                        new_bases.setdefault(key, []).extend(
+                            _resolved_bases(info, symbol_store, index_lock, memo)
+                        )
+                        new_names.setdefault(key, set()).add(info.name)
+                        if info.is_project:
+                            new_project.add(key)
+
+        changed = [
+            key
+            for key in sorted(affected)
+            if new_bases.get(key) != self.class_bases.get(key)
+            or new_names.get(key) != self.class_names.get(key)
+            or (key in new_project) != (key in self.project_keys)
+        ]
+        if not changed:
+            return self
+
+        closure = self._copy()
+        closure._patch(changed, new_bases, new_names, new_project)
+        if (
+            closure._interval_count > 2 * closure._labeled_interval_count
+            or 2 * closure._unused_numbers > len(closure.order)
+        ):
+            return InheritanceClosure(
+                closure.class_bases, closure.project_keys, closure.class_names
+            )
+        return closure
+
+    def _copy(self) -> "InheritanceClosure":
+        """Shallow copy; _patch replaces (never mutates) the lists and sets it changes."""
+        closure = InheritanceClosure.__new__(InheritanceClosure)
+        closure.project_keys = set(self.project_keys)
+        closure.class_bases = dict(self.class_bases)
+        closure.class_names = dict(self.class_names)
+        closure._keys_by_name = defaultdict(set, self._keys_by_name)
+        closure.bases = dict(self.bases)
+        closure.derived = defaultdict(list, self.derived)
+        closure.post = dict(self.post)
+        closure.order = list(self.order)
+        closure.intervals = dict(self.intervals)
+        closure.depth = dict(self.depth)
+        closure._interval_count = self._interval_count
+        closure._labeled_interval_count = self._labeled_interval_count
+        closure._unused_numbers = self._unused_numbers
+        return closure
+
+    def _patch(
+        self,
+        changed: List[str],
+        new_bases: Dict[str, List[str]],
+        new_names: Dict[str, Set[str]],
+        new_project: Set[str],
+    ) -> None:
+        """Apply the re-resolved classes to a fresh copy (see updated())."""
+        # Classes whose bases changed, and the bases gaining or losing them
+        rebased: Set[str] = set()
+        touched_bases: Set[str] = set()
+        unique_bases: Dict[str, List[str]] = {}
+        for key in changed:
+            raw = new_bases.get(key)
+            unique = list(dict.fromkeys(b for b in raw or () if b != key))
+            unique_bases[key] = unique
+            old = self.bases.get(key, [])
+            if unique != old or (key in new_bases and key not in self.bases):
+                rebased.add(key)
+                touched_bases.update(set(old) ^ set(unique))
+        # Their ancestors before the change may lose subclasses
+        stale = self._reachable(touched_bases, self.bases)
+
+        for key in changed:
+            for name in self.class_names.get(key, ()):
+                self._keys_by_name[name] = self._keys_by_name[name] - {key}
+                if not self._keys_by_name[name]:
+                    del self._keys_by_name[name]
+            if key in new_bases:
+                self.class_bases[key] = new_bases[key]
+                self.class_names[key] = new_names[key]
+                for name in new_names[key]:
+                    self._keys_by_name[name] = self._keys_by_name.get(name, set()) | {key}
+            else:
+                self.class_bases.pop(key, None)
+                self.class_names.pop(key, None)
+            if key in new_project:
+                self.project_keys.add(key)
+            else:
+                self.project_keys.discard(key)
+
+        for key in sorted(rebased):
+            old = self.bases.get(key, [])
+            unique = unique_bases[key]
+            for base in set(old) - set(unique):
+                remaining = [d for d in self.derived[base] if d != key]
+                if remaining:
+                    self.derived[base] = remaining
+                else:
+                    del self.derived[base]
+            for base in set(unique) - set(old):
+                siblings = list(self.derived.get(base, ()))
+                insort(siblings, key)
+                self.derived[base] = siblings
+                self.bases.setdefault(base, [])
+            self.bases[key] = unique
+
+        # Drop nodes left without class symbols or subclasses; number new ones
+        for key in sorted(set(changed) | touched_bases):
+            if key in self.bases and key not in self.class_bases and not self.derived.get(key):
+                del self.bases[key]
+                self.order[self.post.pop(key)] = None
+                self._unused_numbers += 1
+                self._interval_count -= len(self.intervals.pop(key))
+                del self.depth[key]
+        added = sorted(
+            key for key in touched_bases | rebased if key in self.bases and key not in self.post
+        )
+        for key in added:
+            self.post[key] = len(self.order)
+            self.order.append(key)
+            self.intervals[key] = []
+            self.depth[key] = 0
+
+        seeds = {key for key in touched_bases | set(added) if key in self.bases}
+        relabeled = self._reachable(seeds, self.bases) | {k for k in stale if k in self.bases}
+        self._relabel(relabeled)
+        moved = {key for key in rebased if key in self.bases}
+        self._update_depths(self._reachable(moved | set(added), self.derived))
+
+    @staticmethod
+    def _reachable(keys: Iterable[str], edges: Dict[str, List[str]]) -> Set[str]:
+        """keys and every key reachable from them over edges."""
+        seen = set(keys)
+        frontier = list(seen)
+        while frontier:
+            for nxt in edges.get(frontier.pop(), ()):
+                if nxt not in seen:
+                    seen.add(nxt)
+                    frontier.append(nxt)
+        return seen
+
+    def _relabel(self, keys: Set[str]) -> None:
+        """Recompute the intervals of keys, subclasses first; other classes keep theirs."""
+        done: Set[str] = set()
+        on_stack: Set[str] = set()
+        for top in sorted(keys):
+            if top in done:
+                continue
+            stack = [(top, iter(self.derived.get(top, ())))]
+            on_stack.add(top)
+            while stack:
+                key, children = stack[-1]
+                for child in children:
+                    if child in keys and child not in done and child not in on_stack:
+                        on_stack.add(child)
+                        stack.append((child, iter(self.derived.get(child, ()))))
+                        break
+                else:
+                    stack.pop()
+                    on_stack.discard(key)
+                    done.add(key)
+                    number = self.post[key]
+                    own = [(number, number)]
+                    for child in self.derived.get(key, ()):
+                        # Children still on the stack close a cycle
+                        if child not in on_stack:
+                            own.extend(self.intervals[child])
+                    merged = _merge_intervals(own)
+                    self._interval_count += len(merged) - len(self.intervals[key])
+                    self.intervals[key] = merged
+
+    def _update_depths(self, keys: Set[str]) -> None:
+        """Recompute the depths of keys, bases first; other classes keep theirs."""
+        pending = {key: sum(1 for b in self.bases[key] if b in keys) for key in keys}
+        ready = deque(sorted(key for key, count in pending.items() if not count))
+        while keys:
+            if not ready:
+                # Only cycles left (name collisions): break one open
+                ready.append(min(keys))
+            key = ready.popleft()
+            if key not in keys:
+                continue
+            keys.discard(key)
+            self.depth[key] = max(
+                (self.depth[b] + 1 for b in self.bases[key] if b not in keys), default=0
+            )
+            for child in self.derived.get(key, ()):
+                if child in keys:
+                    pending[child] -= 1
+                    if not pending[child]:
+                        ready.append(child)
+
+    def _label(self) -> None:
+        """Number classes in post-order and compute their descendant intervals."""
+        roots = [key for key, bases in self.bases.items() if not bases]
+        on_stack: Set[str] = set()
+        for root in roots + list(self.bases):
+            if root in self.post or root in on_stack:
+                continue
+            # Frames: (key, iterator over derived classes, first number of the subtree)
+            stack = [(root, iter(self.derived.get(root, ())), len(self.order))]
+            on_stack.add(root)
+            while stack:
+                key, children, start = stack[-1]
+                for child in children:
+                    if child not in self.post and child not in on_stack:
+                        on_stack.add(child)
+                        stack.append((child, iter(self.derived.get(child, ())), len(self.order)))
+                        break
+                else:
+                    stack.pop()
+                    on_stack.discard(key)
+                    number = len(self.order)
+                    self.order.append(key)
+                    self.post[key] = number
+                    own = [(start, number)]
+                    for child in self.derived.get(key, ()):
+                        # Children still on the stack close a cycle
+                        if child in self.intervals:
+                            own.extend(self.intervals[child])
+                    self.intervals[key] = _merge_intervals(own)
+
+    def __contains__(self, key: str) -> bool:
+        return key in self.post
+
+    def is_derived_from(self, key: str, base_key: str) -> bool:
+        """True if class key derives from base_key, directly or transitively."""
+        number = self.post.get(key)
+        intervals = self.intervals.get(base_key)
+        if number is None or intervals is None or key == base_key:
+            return False
+        i = bisect_right(intervals, (number, len(self.order))) - 1
+        return i >= 0 and intervals[i][0] <= number <= intervals[i][1]
+
+    def derived_classes(self, key: str) -> List[str]:
+        """Direct subclasses of a class."""
+        return list(self.derived.get(key, ()))
+
+    def descendant_count(self, key: str) -> int:
+        intervals = self.intervals.get(key)
+        if not intervals:
+            return 0
+        return sum(high - low + 1 for low, high in intervals) - 1
+
+    def stats(self, limit: int = 10, project_only: bool = True) -> Dict[str, Any]:
+        """Depth and fan-out summary of the inheritance graph.
+
+        Args:
+            limit: Entries in the ``deepest`` and ``widest`` lists.
+            project_only: Only report project classes (subclass counts still
+                include every indexed subclass).
+        """
+        keys = [
+            k for k in self.order if k is not None and (not project_only or k in self.project_keys)
+        ]
+        histogram = Counter(self.depth[k] for k in keys)
+        deepest = sorted(keys, key=lambda k: (-self.depth[k], k))[:limit]
+        widest = sorted(
+            (k for k in keys if self.derived.get(k)),
+            key=lambda k: (-self.descendant_count(k), -len(self.derived[k]), k),
+        )[:limit]
+        return {
+            "total_classes": len(keys),
+            "root_classes": sum(1 for k in keys if not self.bases[k]),
+            "classes_with_subclasses": sum(1 for k in keys if self.derived.get(k)),
+            "max_depth": max(histogram, default=0),
+            "depth_histogram": {str(d): histogram[d] for d in sorted(histogram)},
+            "deepest": [
+                {"qualified_name": k, "depth": self.depth[k], "base_classes": self.bases[k]}
+                for k in deepest
+                if self.depth[k] > 0
+            ],
+            "widest": [
+                {
+                    "qualified_name": k,
+                    "direct_subclasses": len(self.derived[k]),
+                    "total_subclasses": self.descendant_count(k),
+                }
+                for k in widest
+            ],
+        }
+
+
+def get_derived_classes(
+    class_name: str,
+    project_only: bool,
+    closure: InheritanceClosure,
+    symbol_store,
+    index_lock,
+) -> List[Dict[str, Any]]:
+    """Direct subclasses of a class, read from the closure's edges.
+
+    Returns the same entries as template_analyzer.get_derived_classes.  A
+    class that is not indexed (an external base) is looked up by its name as
+    written in the bases of its subclasses.
+    """
+    return get_derived_classes_many(
+        [class_name], project_only, closure, symbol_store, index_lock
+    )[class_name]
+
+
+def get_derived_classes_many(
+    class_names: Iterable[str],
+    project_only: bool,
+    closure: InheritanceClosure,
+    symbol_store,
+    index_lock,
+) -> Dict[str, List[Dict[str, Any]]]:
+    """get_derived_classes for several classes in one pass, keyed by class name.
+
+    Each subclass is looked up and turned into an entry once, however many of
+    the classes it derives from.
+    """
+    entries_by_key: Dict[str, List[Dict[str, Any]]] = {}
+    derived_by_name: Dict[str, List[Dict[str, Any]]] = {}
+    with index_lock:
+        for class_name in class_names:
+            if class_name in derived_by_name:
+                continue
+            infos = lookup_class_infos(class_name, symbol_store, index_lock)
+            keys = [info.qualified_name or info.name for info in infos] or [class_name]
+            derived_keys = dict.fromkeys(d for key in keys for d in closure.derived.get(key, ()))
+            derived_classes = []
+            for derived_key in derived_keys:
+                entries = entries_by_key.get(derived_key)
+                if entries is None:
+                    entries = _derived_entries(derived_key, project_only, symbol_store, index_lock)
+                    entries_by_key[derived_key] = entries
+                derived_classes.extend(dict(entry) for entry in entries)
+            derived_by_name[class_name] = derived_classes
+    return derived_by_name
+
+
+def _derived_entries(
+    derived_key: str, project_only: bool, symbol_store, index_lock
+) -> List[Dict[str, Any]]:
+    """get_derived_classes entries of the indexed classes named derived_key."""
+    return [
+        omit_empty(
+            {
+                "qualified_name": derived_key,
+                "kind": info.kind,
+                "is_project": info.is_project,
+                "base_classes": info.base_classes,
+                **build_location_objects(info),
+            }
+        )
+        for info in lookup_class_infos(derived_key, symbol_store, index_lock)
+        if (info.qualified_name or info.name) == derived_key
+        and (not project_only or info.is_project)
+    ]
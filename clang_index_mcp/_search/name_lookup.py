@@ -0,0 +1,155 @@
+"""Name lookup structures backing smart fallback suggestions.
+
+SmartFallback runs only after a search came back empty, so it must not cost
+another full scan of the index.  NameLookup answers its questions from the
+name keys of class_index/function_index:
+
+- exact and case-insensitive lookups through a lowercase name map,
+- edit-distance candidates by enumerating the edits of the query against that
+  map (distance 1 exhaustively, distance 2 while the time budget lasts),
+- regex candidates by pruning the name vocabulary to names containing the
+  pattern's longest literal run before running the regex.
+
+A SymSpell delete table would answer distance-2 queries without enumeration,
+but building one for a few hundred thousand names takes seconds in Python;
+the lowercase map is built in a single pass and then kept up to date with
+the names of the symbols added and removed since (see update).
+"""
+
+import re
+import time
+from typing import Any, Dict, Iterable, Iterator, List, Optional, Sequence, Set
+
+# Characters that occur in C++ identifiers (lowercased).
+_IDENTIFIER_CHARS = "abcdefghijklmnopqrstuvwxyz0123456789_"
+
+# Regex metacharacters / constructs that break a literal run.
+_LITERAL_BREAK_RE = re.compile(r"\\.|\[[^\]]*\]|[.*+?{}()|^$]")
+
+
+def edits1(word: str) -> Set[str]:
+    """Return all strings one delete, transpose, replace or insert away from word."""
+    splits = [(word[:i], word[i:]) for i in range(len(word) + 1)]
+    deletes = [a + b[1:] for a, b in splits if b]
+    transposes = [a + b[1] + b[0] + b[2:] for a, b in splits if len(b) > 1]
+    replaces = [a + c + b[1:] for a, b in splits if b for c in _IDENTIFIER_CHARS]
+    inserts = [a + c + b for a, b in splits for c in _IDENTIFIER_CHARS]
+    return set(deletes + transposes + replaces + inserts)
+
+
+def longest_literal(pattern: str) -> str:
+    """Return the longest run of plain characters every regex match must contain.
+
+    Returns "" when the pattern uses alternation (no run is mandatory).  A
+    character followed by a quantifier is optional and ends the run early.
+    Runs containing "::" are skipped: they may match the namespace part of a
+    qualified name rather than the simple name.
+    """
+    if "|" in pattern:
+        return ""
+    best = ""
+    pos = 0
+    for match in _LITERAL_BREAK_RE.finditer(pattern + "$"):
+        run = pattern[pos : match.start()]
+        if run and match.group(0)[:1] in ("*", "?", "{"):
+            run = run[:-1]
+        if ":" not in run and len(run) > len(best):
+            best = run
+        pos = match.end()
+    return best
+
+
+class NameLookup:
+    """Case-insensitive and edit-distance lookups over name-keyed indexes."""
+
+    def __init__(self, indexes: Sequence[Dict[str, List[Any]]]):
+        """
+        Args:
+            indexes: Name-keyed indexes (class_index and/or function_index).
+        """
+        self._indexes = indexes
+        self._by_lower: Dict[str, List[str]] = {}
+        for index in indexes:
+            for name in index:
+                self._add_name(name)
+
+    def _add_name(self, name: str) -> None:
+        names = self._by_lower.setdefault(name.lower(), [])
+        if name not in names:
+            names.append(name)
+
+    def update(self, added: Iterable[str], removed: Iterable[str]) -> None:
+        """Catch up with the names of symbols added to and removed from the indexes."""
+        for name in removed:
+            if any(name in index for index in self._indexes):
+                continue
+            names = self._by_lower.get(name.lower())
+            if names and name in names:
+                names.remove(name)
+                if not names:
+                    del self._by_lower[name.lower()]
+        for name in added:
+            if any(name in index for index in self._indexes):
+                self._add_name(name)
+
+    def symbols(self, name: str, max_results: int = 10) -> List[Any]:
+        """Return symbols named exactly name, else named name ignoring case."""
+        results = self._symbols_named([name], max_results)
+        if not results:
+            results = self._symbols_named(self._by_lower.get(name.lower(), []), max_results)
+        return results
+
+    def has_name(self, name: str) -> bool:
+        """Return True if some symbol is named name, ignoring case."""
+        return name.lower() in self._by_lower
+
+    def similar_names(self, name: str, deadline: float, max_results: int = 10) -> List[str]:
+        """Return names within edit distance 1 (or 2, time permitting) of name.
+
+        Distance-1 matches come first, most common names first.  Names of up
+        to four characters only get distance-1 candidates.  Distance-2
+        enumeration expands the shortest edits first (deletes, i.e. an extra
+        character typed), so the deadline cuts off the insert-heavy tail.
+        """
+        query = name.lower()
+        first = self._known(edits1(query) - {query})
+        if first or len(query) <= 4:
+            return self._rank(first)[:max_results]
+
+        second: Set[str] = set()
+        for edit in sorted(edits1(query), key=len):
+            if time.monotonic() > deadline:
+                break
+            second.update(self._known(edits1(edit)))
+        second.discard(query)
+        return self._rank(second)[:max_results]
+
+    def regex_candidates(self, pattern: str, deadline: float) -> Iterator[Any]:
+        """Yield symbols whose simple name could satisfy a regex pattern.
+
+        Names are pruned to those containing the pattern's longest literal
+        run (case-insensitively); the caller still has to run the regex.
+        Stops yielding once the deadline has passed.
+        """
+        literal = longest_literal(pattern).lower()
+        for lower, names in self._by_lower.items():
+            if time.monotonic() > deadline:
+                return
+            if literal and literal not in lower:
+                continue
+            yield from self._symbols_named(names, None)
+
+    def _known(self, candidates: Iterable[str]) -> Set[str]:
+        return {c for c in candidates if c in self._by_lower}
+
+    def _rank(self, lowered: Iterable[str]) -> List[str]:
+        """Map lowercase names back to index names, most symbols first."""
+        names = [name for lower in lowered for name in self._by_lower[lower]]
+        return sorted(names, key=lambda n: (-len(self._symbols_named([n], None)), n))
+
+    def _symbols_named(self, names: Iterable[str], max_results: Optional[int]) -> List[Any]:
+        results: List[Any] = []
+        for name in names:
+            for index in self._indexes:
+                results.extend(index.get(name, ()))
+        return results if max_results is None else results[:max_results]
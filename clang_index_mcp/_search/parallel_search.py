@@ -0,0 +1,298 @@
+"""Sharded, parallel verification of function search candidates.
+
+Regex and signature_pattern searches have to verify every entry of
+function_index, and building a prototype per candidate dominates that cost.
+ParallelFunctionSearch keeps a snapshot of the function candidates sharded by
+name hash, fans verification out over one worker per shard and puts the
+matching positions back into index order, so results are identical to a
+serial scan of function_index.
+
+Workers are threads on a free-threaded interpreter (no GIL) and dedicated
+spawn processes otherwise.  Process workers keep their shard resident; when
+the store changes they only receive the functions added since (see
+FunctionSnapshot), so a query only ships the criteria out and a list of
+integer positions back.
+"""
+
+import itertools
+import multiprocessing
+import signal
+import sys
+import threading
+import zlib
+from concurrent.futures import ThreadPoolExecutor
+from typing import TYPE_CHECKING, Any, List, Optional, Tuple
+
+from .._core import diagnostics
+from .._symbols.model import SymbolInfo
+from .function_snapshot import FunctionSnapshot
+from .signature_index import SignaturePattern
+from .symbol_filters import matches_function_criteria
+
+if TYPE_CHECKING:
+    from .._symbols.symbol_index_store import SymbolIndexStore
+
+# (pattern, pattern_type, project_only, class_name, namespace, signature_pattern)
+MatchArgs = Tuple[str, str, bool, Optional[str], Optional[str], Optional[SignaturePattern]]
+ShardRows = List[Tuple[int, SymbolInfo]]
+
+
+def shard_of(name: str, shard_count: int) -> int:
+    """Return a stable shard number for a symbol name.
+
+    Uses crc32 rather than hash() so the assignment does not depend on
+    PYTHONHASHSEED and is identical in every process.
+    """
+    return zlib.crc32(name.encode("utf-8")) % shard_count
+
+
+def free_threading_active() -> bool:
+    """Return True when running on a free-threaded interpreter with the GIL off."""
+    is_gil_enabled = getattr(sys, "_is_gil_enabled", None)
+    return is_gil_enabled is not None and not is_gil_enabled()
+
+
+def _match_positions(rows: ShardRows, args: MatchArgs) -> List[int]:
+    """Return the positions of rows matching the criteria, in ascending order."""
+    pattern, pattern_type, project_only, class_name, namespace, signature_pattern = args
+    return [
+        pos
+        for pos, info in rows
+        if matches_function_criteria(
+            info, pattern, pattern_type, project_only, class_name, namespace, signature_pattern
+        )
+    ]
+
+
+def _to_wire(info: SymbolInfo) -> Tuple[Any, ...]:
+    """Reduce a SymbolInfo to the fields function matching reads."""
+    return (
+        info.name,
+        info.kind,
+        info.qualified_name,
+        info.signature,
+        info.is_project,
+        info.namespace,
+        info.access,
+        info.parent_class,
+        info.is_virtual,
+        info.is_pure_virtual,
+        info.is_static,
+    )
+
+
+def _from_wire(row: Tuple[Any, ...]) -> SymbolInfo:
+    """Rebuild a match-only SymbolInfo from _to_wire() output."""
+    (
+        name,
+        kind,
+        qualified_name,
+        signature,
+        is_project,
+        namespace,
+        access,
+        parent_class,
+        is_virtual,
+        is_pure_virtual,
+        is_static,
+    ) = row
+    return SymbolInfo(
+        name=name,
+        kind=kind,
+        file="",
+        line=0,
+        column=0,
+        qualified_name=qualified_name,
+        signature=signature,
+        is_project=is_project,
+        namespace=namespace,
+        access=access,
+        parent_class=parent_class,
+        is_virtual=is_virtual,
+        is_pure_virtual=is_pure_virtual,
+        is_static=is_static,
+    )
+
+
+def _shard_worker_main(conn) -> None:
+    """Entry point of a shard worker process.
+
+    Protocol (tuples over a duplex Pipe):
+        ("load", [(pos, wire_row), ...])  replace the resident shard, no reply
+        ("add", [(pos, wire_row), ...])   append to the resident shard, no reply
+        ("match", MatchArgs)              reply with matching positions or an exception
+        ("stop",)                         exit
+    """
+    signal.signal(signal.SIGINT, signal.SIG_IGN)
+    rows: ShardRows = []
+    while True:
+        try:
+            message = conn.recv()
+        except (EOFError, OSError):
+            break
+        op = message[0]
+        if op == "load":
+            rows = [(pos, _from_wire(wire)) for pos, wire in message[1]]
+        elif op == "add":
+            rows.extend((pos, _from_wire(wire)) for pos, wire in message[1])
+        elif op == "match":
+            try:
+                conn.send(_match_positions(rows, message[1]))
+            except Exception as e:
+                conn.send(e)
+        else:
+            break
+    conn.close()
+
+
+class ParallelFunctionSearch:
+    """Verifies function search candidates in parallel over name-hash shards."""
+
+    def __init__(self, workers: int, min_candidates: int):
+        """
+        Args:
+            workers: Number of shards/workers. 1 disables parallel search.
+            min_candidates: Smallest candidate count worth fanning out; smaller
+                indexes are scanned serially by the caller.
+        """
+        self.workers = workers
+        self.min_candidates = min_candidates
+        self.mode = "thread" if free_threading_active() else "process"
+        self._lock = threading.Lock()
+        self._snapshot = FunctionSnapshot()
+        self._shards: List[ShardRows] = []
+        # Whether the process workers hold the current shards
+        self._workers_loaded = False
+        self._thread_pool: Optional[ThreadPoolExecutor] = None
+        self._processes: List[Any] = []
+        self._conns: List[Any] = []
+
+    @property
+    def enabled(self) -> bool:
+        return self.workers > 1
+
+    def search(self, store: "SymbolIndexStore", args: MatchArgs) -> Optional[List[SymbolInfo]]:
+        """Return matching function symbols in function_index order.
+
+        Returns None when parallel search is disabled, the index is below
+        min_candidates, or a worker failed; the caller then scans serially.
+        """
+        if not self.enabled:
+            return None
+
+        with self._lock:
+            try:
+                if not self._refresh_snapshot(store):
+                    return None
+                if self.mode == "thread":
+                    per_shard = self._match_in_threads(args)
+                else:
+                    per_shard = self._match_in_processes(args)
+                with store.index_lock:
+                    return self._snapshot.in_index_order(store, itertools.chain(*per_shard))
+            except Exception as e:
+                diagnostics.warning(f"Parallel search failed, falling back to serial scan: {e}")
+                self._stop_processes()
+                self._snapshot.clear()
+                self._workers_loaded = False
+                return None
+
+    def _refresh_snapshot(self, store: "SymbolIndexStore") -> bool:
+        """Bring the shards up to date with the store.
+
+        Returns True if the snapshot is large enough for parallel verification.
+        """
+        with store.index_lock:
+            start = self._snapshot.sync(store)
+        functions = self._snapshot.functions
+        if start is None:
+            self._shards = [[] for _ in range(self.workers)]
+            self._workers_loaded = False
+            start = 0
+        added: List[ShardRows] = [[] for _ in range(self.workers)]
+        for pos in range(start, len(functions)):
+            added[shard_of(functions[pos].name, self.workers)].append((pos, functions[pos]))
+        for shard, rows in zip(self._shards, added):
+            shard.extend(rows)
+        if len(functions) < self.min_candidates:
+            self._workers_loaded = False
+            return False
+
+        if self.mode == "process":
+            op = "add"
+            if self._ensure_processes() or not self._workers_loaded:
+                # New workers or a rebuilt snapshot: ship the whole shards
+                added = self._shards
+                op = "load"
+            for conn, rows in zip(self._conns, added):
+                if rows or op == "load":
+                    conn.send((op, [(pos, _to_wire(info)) for pos, info in rows]))
+            self._workers_loaded = True
+            if op == "load":
+                diagnostics.debug(
+                    f"Parallel search: loaded {len(functions)} functions into "
+                    f"{self.workers} shards (generation {self._snapshot.generation})"
+                )
+        return True
+
+    def _match_in_threads(self, args: MatchArgs) -> List[List[int]]:
+        if self._thread_pool is None:
+            self._thread_pool = ThreadPoolExecutor(
+                max_workers=self.workers, thread_name_prefix="search-shard"
+            )
+        futures = [self._thread_pool.submit(_match_positions, s, args) for s in self._shards]
+        return [f.result() for f in futures]
+
+    def _match_in_processes(self, args: MatchArgs) -> List[List[int]]:
+        for conn in self._conns:
+            conn.send(("match", args))
+        per_shard: List[List[int]] = []
+        for conn in self._conns:
+            reply = conn.recv()
+            if isinstance(reply, Exception):
+                raise reply
+            per_shard.append(reply)
+        return per_shard
+
+    def _ensure_processes(self) -> bool:
+        """Start the shard workers unless they are all running; True if they were started."""
+        if self._processes and all(p.is_alive() for p in self._processes):
+            return False
+        self._stop_processes()
+        mp_context = multiprocessing.get_context("spawn")
+        for _ in range(self.workers):
+            parent_conn, child_conn = mp_context.Pipe()
+            process = mp_context.Process(
+                target=_shard_worker_main, args=(child_conn,), daemon=True
+            )
+            process.start()
+            child_conn.close()
+            self._processes.append(process)
+            self._conns.append(parent_conn)
+        diagnostics.debug(f"Parallel search: started {self.workers} shard worker processes")
+        return True
+
+    def _stop_processes(self) -> None:
+        for conn in self._conns:
+            try:
+                conn.send(("stop",))
+                conn.close()
+            except Exception:
+                pass
+        for process in self._processes:
+            process.join(timeout=1.0)
+            if process.is_alive():
+                process.terminate()
+        self._processes = []
+        self._conns = []
+
+    def close(self) -> None:
+        """Stop shard workers and drop the snapshot."""
+        with self._lock:
+            self._stop_processes()
+            if self._thread_pool is not None:
+                self._thread_pool.shutdown(wait=False)
+                self._thread_pool = None
+            self._snapshot.clear()
+            self._shards = []
+
@@ -0,0 +1,236 @@
+"""Bounded shortest-path search over the call graph.
+
+shortest_path() is a bidirectional BFS: it grows the smaller of a forward
+(callee) and a backward (caller) frontier one level at a time and stops
+where they meet, keeping parent pointers instead of copying paths.  For two
+functions d calls apart it visits roughly two balls of radius d/2 instead of
+one of radius d.
+
+k_shortest_paths() applies Yen's algorithm on top of it to return the k
+shortest simple paths in order of length.  Every search of one query shares
+a SearchBudget (visited-node limit and deadline); once it runs out the paths
+found so far are returned and the result is marked incomplete.
+
+reachable_depths() is the plain level-by-level BFS behind transitive caller
+and callee queries when no CSR snapshot is available.
+"""
+
+import heapq
+import time
+from typing import (
+    Callable,
+    Dict,
+    FrozenSet,
+    Hashable,
+    Iterable,
+    List,
+    Optional,
+    Set,
+    Tuple,
+)
+
+Node = Hashable
+Neighbors = Callable[[Node], Iterable[Node]]
+
+# Virtual endpoints joining every source / every target, so a multi-source,
+# multi-target query is a single source-to-target search.
+_SOURCE = ("<source>",)
+_TARGET = ("<target>",)
+
+
+class SearchBudget:
+    """Node-expansion limit and deadline shared by the searches of one query."""
+
+    def __init__(self, max_nodes: int, timeout_ms: float):
+        self.remaining = max_nodes
+        self.deadline = time.monotonic() + timeout_ms / 1000.0
+        self.exhausted = False
+
+    def spend(self) -> bool:
+        """Account for one expanded node; returns False once the budget is spent."""
+        self.remaining -= 1
+        if self.remaining < 0 or time.monotonic() > self.deadline:
+            self.exhausted = True
+        return not self.exhausted
+
+
+def shortest_path(
+    source: Node,
+    target: Node,
+    forward: Neighbors,
+    backward: Neighbors,
+    max_edges: int,
+    budget: SearchBudget,
+    banned_nodes: FrozenSet[Node] = frozenset(),
+    banned_edges: FrozenSet[Tuple[Node, Node]] = frozenset(),
+) -> Optional[List[Node]]:
+    """Return a shortest source -> target path of at most max_edges edges, or None.
+
+    banned_nodes and banned_edges are treated as absent from the graph.
+    """
+    if source == target:
+        return [source]
+
+    fwd_parent: Dict[Node, Optional[Node]] = {source: None}
+    bwd_parent: Dict[Node, Optional[Node]] = {target: None}
+    fwd_frontier: List[Node] = [source]
+    bwd_frontier: List[Node] = [target]
+    depth = 0
+
+    while fwd_frontier and bwd_frontier and depth < max_edges:
+        expand_forward = len(fwd_frontier) <= len(bwd_frontier)
+        frontier = fwd_frontier if expand_forward else bwd_frontier
+        parents, others = (fwd_parent, bwd_parent) if expand_forward else (bwd_parent, fwd_parent)
+        neighbors = forward if expand_forward else backward
+
+        next_frontier: List[Node] = []
+        for node in frontier:
+            if not budget.spend():
+                return None
+            for neighbor in neighbors(node):
+                edge = (node, neighbor) if expand_forward else (neighbor, node)
+                if neighbor in parents or neighbor in banned_nodes or edge in banned_edges:
+                    continue
+                parents[neighbor] = node
+                if neighbor in others:
+                    return _join(neighbor, fwd_parent, bwd_parent)
+                next_frontier.append(neighbor)
+
+        if expand_forward:
+            fwd_frontier = next_frontier
+        else:
+            bwd_frontier = next_frontier
+        depth += 1
+    return None
+
+
+def _join(
+    meet: Node, fwd_parent: Dict[Node, Optional[Node]], bwd_parent: Dict[Node, Optional[Node]]
+) -> List[Node]:
+    path: List[Node] = []
+    node: Optional[Node] = meet
+    while node is not None:
+        path.append(node)
+        node = fwd_parent[node]
+    path.reverse()
+    node = bwd_parent[meet]
+    while node is not None:
+        path.append(node)
+        node = bwd_parent[node]
+    return path
+
+
+def k_shortest_paths(
+    source: Node,
+    target: Node,
+    forward: Neighbors,
+    backward: Neighbors,
+    k: int,
+    max_edges: int,
+    budget: SearchBudget,
+) -> List[List[Node]]:
+    """Return up to k shortest simple source -> target paths (Yen's algorithm)."""
+    first = shortest_path(source, target, forward, backward, max_edges, budget)
+    if first is None:
+        return []
+
+    found: List[List[Node]] = [first]
+    candidates: List[Tuple[int, int, List[Node]]] = []
+    seen: Set[Tuple[Node, ...]] = {tuple(first)}
+    counter = 0
+
+    while len(found) < k:
+        previous = found[-1]
+        for i in range(len(previous) - 1):
+            root = previous[: i + 1]
+            banned_edges = frozenset(
+                (path[i], path[i + 1])
+                for path in found
+                if len(path) > i + 1 and path[: i + 1] == root
+            )
+            spur = shortest_path(
+                root[-1],
+                target,
+                forward,
+                backward,
+                max_edges - i,
+                budget,
+                banned_nodes=frozenset(root[:-1]),
+                banned_edges=banned_edges,
+            )
+            if budget.exhausted:
+                return found
+            if spur is None:
+                continue
+            candidate = root[:-1] + spur
+            if tuple(candidate) not in seen:
+                seen.add(tuple(candidate))
+                counter += 1
+                heapq.heappush(candidates, (len(candidate), counter, candidate))
+
+        if not candidates:
+            break
+        found.append(heapq.heappop(candidates)[2])
+    return found
+
+
+def find_call_paths(
+    sources: Set[Node],
+    targets: Set[Node],
+    callees: Neighbors,
+    callers: Neighbors,
+    max_edges: int,
+    max_paths: int,
+    budget: SearchBudget,
+) -> List[List[Node]]:
+    """Return up to max_paths shortest paths from any source to any target, shortest first."""
+    if not sources or not targets or max_edges < 0:
+        return []
+
+    def forward(node: Node) -> Iterable[Node]:
+        if node is _SOURCE:
+            return sources
+        nodes = list(callees(node))
+        if node in targets:
+            nodes.append(_TARGET)
+        return nodes
+
+    def backward(node: Node) -> Iterable[Node]:
+        if node is _TARGET:
+            return targets
+        nodes = list(callers(node))
+        if node in sources:
+            nodes.append(_SOURCE)
+        return nodes
+
+    # Two extra edges connect the virtual endpoints.
+    paths = k_shortest_paths(_SOURCE, _TARGET, forward, backward, max_paths, max_edges + 2, budget)
+    return [path[1:-1] for path in paths]
+
+
+def reachable_depths(
+    sources: Iterable[Node],
+    neighbors: Neighbors,
+    max_depth: int,
+    max_nodes: Optional[int] = None,
+) -> Tuple[Dict[Node, int], bool]:
+    """Map nodes within max_depth edges of sources to their distance (sources map to 0).
+
+    Stops once max_nodes nodes besides the sources were reached; the second
+    value is True when that cut off part of the result.
+    """
+    depths: Dict[Node, int] = {node: 0 for node in sources}
+    limit = len(depths) + max_nodes if max_nodes is not None else None
+    frontier = list(depths)
+    for depth in range(1, max_depth + 1):
+        next_frontier: List[Node] = []
+        for node in frontier:
+            for neighbor in neighbors(node):
+                if neighbor in depths:
+                    continue
+                if limit is not None and len(depths) >= limit:
+                    return depths, True
+                depths[neighbor] = depth
+                next_frontier.append(neighbor)
+        frontier = next_frontier
+    return depths, False
@@ -22,6 +22,15 @@ class SearchIndexStore(Protocol):
     def get_classes_by_name(self, name: str) -> Any:
         pass
 
+    def get_derived_class_candidates(self, name: str) -> Any:
+        pass
+
+    def class_change_version(self) -> int:
+        pass
+
+    def get_class_changes_since(self, version: int) -> Any:
+        pass
+
     def get_functions_by_name(self, name: str) -> Any:
         pass
 
@@ -0,0 +1,141 @@
+"""LRU cache for query results, keyed by normalized arguments and index generation.
+
+LLM clients repeat the same searches, class lookups and call-graph queries
+many times within a session.  QueryResultCache sits in front of QueryEngine
+and CallGraphService and returns a previous result when the same operation is
+asked again with the same arguments and the data it was computed from has not
+changed since: the symbol store generation (SymbolIndexStore.generation), plus
+the call edge version for call-graph queries.  Each operation keeps its own
+generation, so a streamed file's call edges do not drop cached symbol queries.
+
+Results are stored pickled: the pickle length gives the byte size used for the
+bound, and every hit hands the caller a fresh copy it may mutate freely (the
+MCP handlers pop internal keys off call-graph results).
+"""
+
+import pickle
+import threading
+from collections import OrderedDict
+from typing import Any, Callable, Dict, Hashable, Tuple
+
+# Results larger than this fraction of the cache are not worth caching: a
+# single entry would evict most of the working set.
+_MAX_ENTRY_FRACTION = 8
+
+
+def _freeze(value: Any) -> Hashable:
+    """Normalize an argument value into a hashable, order-stable form."""
+    if isinstance(value, (list, tuple)):
+        return tuple(_freeze(v) for v in value)
+    if isinstance(value, dict):
+        return tuple(sorted((k, _freeze(v)) for k, v in value.items()))
+    if isinstance(value, set):
+        return tuple(sorted(_freeze(v) for v in value))
+    return value
+
+
+class QueryResultCache:
+    """Byte-bounded LRU cache of query results for the current index generation."""
+
+    def __init__(self, max_bytes: int):
+        """
+        Args:
+            max_bytes: Upper bound on the summed size of cached results.
+                0 disables caching.
+        """
+        self.max_bytes = max_bytes
+        self._lock = threading.Lock()
+        self._entries: "OrderedDict[Tuple[Hashable, ...], bytes]" = OrderedDict()
+        self._bytes = 0
+        # Operation -> generation its cached entries were computed at
+        self._generations: Dict[str, Hashable] = {}
+        self.hits = 0
+        self.misses = 0
+        self.evictions = 0
+
+    @property
+    def enabled(self) -> bool:
+        return self.max_bytes > 0
+
+    def get_or_compute(
+        self,
+        operation: str,
+        args: Tuple[Any, ...],
+        generation: Hashable,
+        compute: Callable[[], Any],
+    ) -> Any:
+        """Return the cached result for (operation, args) or compute and store it.
+
+        Args:
+            operation: Name of the query (e.g. "search_functions").
+            args: All arguments of the query with defaults applied.
+            generation: Current generation of the data the operation reads
+                (SymbolIndexStore.generation, or a tuple including it).
+            compute: Callable producing the result on a miss.
+        """
+        if not self.enabled:
+            return compute()
+
+        key = (operation, _freeze(args))
+        with self._lock:
+            if generation != self._generations.get(operation):
+                # Entries of older generations can never hit again.
+                self._drop_operation(operation)
+                self._generations[operation] = generation
+            payload = self._entries.get(key)
+            if payload is not None:
+                self._entries.move_to_end(key)
+                self.hits += 1
+            else:
+                self.misses += 1
+
+        if payload is not None:
+            return pickle.loads(payload)
+
+        result = compute()
+        try:
+            payload = pickle.dumps(result, protocol=pickle.HIGHEST_PROTOCOL)
+        except Exception:
+            return result
+        if len(payload) > self.max_bytes // _MAX_ENTRY_FRACTION:
+            return result
+
+        with self._lock:
+            # Drop the result if the index changed while it was being computed.
+            if generation == self._generations.get(operation) and key not in self._entries:
+                self._entries[key] = payload
+                self._bytes += len(payload)
+                while self._bytes > self.max_bytes:
+                    _, evicted = self._entries.popitem(last=False)
+                    self._bytes -= len(evicted)
+                    self.evictions += 1
+        return result
+
+    def clear(self) -> None:
+        """Drop all cached results (statistics are kept)."""
+        with self._lock:
+            self._clear_entries()
+
+    def _clear_entries(self) -> None:
+        self._entries.clear()
+        self._generations.clear()
+        self._bytes = 0
+
+    def _drop_operation(self, operation: str) -> None:
+        for key in [k for k in self._entries if k[0] == operation]:
+            self._bytes -= len(self._entries.pop(key))
+
+    def get_stats(self) -> Dict[str, Any]:
+        """Return hit-rate and size statistics for check_system_status."""
+        with self._lock:
+            lookups = self.hits + self.misses
+            return {
+                "enabled": self.enabled,
+                "entries": len(self._entries),
+                "size_bytes": self._bytes,
+                "max_bytes": self.max_bytes,
+                "hits": self.hits,
+                "misses": self.misses,
+                "hit_rate": round(self.hits / lookups, 3) if lookups else 0.0,
+                "evictions": self.evictions,
+            }
@@ -3,6 +3,7 @@
 from dataclasses import dataclass
 from typing import Optional
 
+from .query_cache import QueryResultCache
 from .query_engine import QueryEngine
 
 
@@ -11,3 +12,4 @@ class QueryContext:
     """Search/query surface for MCP tool handlers."""
 
     query_engine: Optional[QueryEngine] = None
+    query_cache: Optional[QueryResultCache] = None
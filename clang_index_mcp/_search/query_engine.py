@@ -7,16 +7,23 @@ and file-based symbol lookup.
 """
 
 import re
-from typing import TYPE_CHECKING, Any, Dict, List, Optional
+from typing import TYPE_CHECKING, Any, Callable, Dict, List, Optional, Tuple
 
 from .._search.file_symbol_finder import find_in_file, get_files_containing_symbol
-from .._search.hierarchy_analyzer import get_class_hierarchy
+from .._search.hierarchy_analyzer import HierarchyMemo, get_class_hierarchy
+from .._search.inheritance_closure import (
+    InheritanceClosure,
+    get_derived_classes,
+    get_derived_classes_many,
+)
+from .._search.parallel_search import ParallelFunctionSearch
+from .._search.query_cache import QueryResultCache
 from .._search.ports.search_deps import SearchDependencies
 from .._search.search_criteria import SearchCriteria
 from .._search.search_engine import SearchEngine
 from .._search.smart_fallback import FallbackResult, SmartFallback
-from .._search.template_analyzer import get_derived_classes
 from .._search.type_alias_resolver import get_type_alias_info
+from .._symbols.inheritance_index import ClassChanges
 
 if TYPE_CHECKING:
     from pathlib import Path
@@ -41,6 +48,8 @@ class QueryEngine:
         project_root: "Path",
         search_engine: Optional[SearchEngine] = None,
         smart_fallback: Optional[SmartFallback] = None,
+        parallel_search: Optional[ParallelFunctionSearch] = None,
+        query_cache: Optional[QueryResultCache] = None,
     ):
         """
         Initialize query engine.
@@ -54,6 +63,8 @@ class QueryEngine:
             project_root: Project root directory.
             search_engine: Optional pre-built SearchEngine instance.
             smart_fallback: Optional pre-built SmartFallback instance.
+            parallel_search: Optional sharded verifier for full function scans.
+            query_cache: Optional result cache for repeated queries.
         """
         self.symbol_store = symbol_store
         self.cache_manager = cache_manager
@@ -64,9 +75,16 @@ class QueryEngine:
         self.search_engine = search_engine or SearchEngine(
             symbol_store=symbol_store,
             cache_manager=cache_manager,
+            parallel_search=parallel_search,
         )
         self.smart_fallback = smart_fallback or SmartFallback()
+        self.query_cache = query_cache
         self._last_fallback: Optional[FallbackResult] = None
+        # Base-key resolutions and hierarchy nodes of the current index generation
+        self._hierarchy_memo = HierarchyMemo()
+        # (generation, class change version, closure), brought up to date
+        # lazily when the index changes
+        self._inheritance_closure: Optional[Tuple[int, int, InheritanceClosure]] = None
 
     def _as_search_deps(self) -> SearchDependencies:
         """Return self as a SearchDependencies-compatible object.
@@ -86,6 +104,24 @@ class QueryEngine:
         self._last_fallback = None
         return result
 
+    def cached(self, operation: str, args: Tuple[Any, ...], compute: Callable[[], Any]) -> Any:
+        """Run compute() through the query result cache, if one is configured."""
+        if self.query_cache is None:
+            return compute()
+        return self.query_cache.get_or_compute(
+            operation, args, self.symbol_store.generation, compute
+        )
+
+    def _cached_search(
+        self,
+        operation: str,
+        args: Tuple[Any, ...],
+        compute: Callable[[], Tuple[Any, Optional[FallbackResult]]],
+    ):
+        """Run a search through the cache, restoring its smart-fallback result."""
+        results, self._last_fallback = self.cached(operation, args, compute)
+        return results
+
     def search_classes(
         self,
         pattern: str,
@@ -96,9 +132,21 @@ class QueryEngine:
         include_base_classes: bool = True,
     ):
         """Search for classes matching pattern"""
+        args = (pattern, project_only, file_name, namespace, max_results, include_base_classes)
+        return self._cached_search("search_classes", args, lambda: self._search_classes(*args))
+
+    def _search_classes(
+        self,
+        pattern: str,
+        project_only: bool,
+        file_name: Optional[str],
+        namespace: Optional[str],
+        max_results: Optional[int],
+        include_base_classes: bool,
+    ) -> Tuple[Any, Optional[FallbackResult]]:
         from .._core import diagnostics
 
-        self._last_fallback = None
+        fallback = None
         try:
             criteria = SearchCriteria(
                 pattern=pattern,
@@ -111,17 +159,17 @@ class QueryEngine:
             results = self.search_engine.search_classes(criteria)
             actual = results[0] if isinstance(results, tuple) else results
             if not actual:
-                self._last_fallback = self.smart_fallback.analyze_empty_result(
+                fallback = self.smart_fallback.analyze_empty_result(
                     pattern=pattern,
                     tool_name="search_classes",
                     symbol_store=self.symbol_store,
                     file_name=file_name,
                     namespace=namespace,
                 )
-            return results
+            return results, fallback
         except re.error as e:
             diagnostics.error(f"Invalid regex pattern: {e}")
-            return []
+            return [], None
 
     def search_functions(
         self,
@@ -135,9 +183,32 @@ class QueryEngine:
         include_attributes: bool = False,
     ):
         """Search for functions matching pattern, optionally within a specific class"""
+        args = (
+            pattern,
+            project_only,
+            class_name,
+            file_name,
+            namespace,
+            max_results,
+            signature_pattern,
+            include_attributes,
+        )
+        return self._cached_search("search_functions", args, lambda: self._search_functions(*args))
+
+    def _search_functions(
+        self,
+        pattern: str,
+        project_only: bool,
+        class_name: Optional[str],
+        file_name: Optional[str],
+        namespace: Optional[str],
+        max_results: Optional[int],
+        signature_pattern: Optional[str],
+        include_attributes: bool,
+    ) -> Tuple[Any, Optional[FallbackResult]]:
         from .._core import diagnostics
 
-        self._last_fallback = None
+        fallback = None
         try:
             criteria = SearchCriteria(
                 pattern=pattern,
@@ -152,7 +223,7 @@ class QueryEngine:
             results = self.search_engine.search_functions(criteria)
             actual = results[0] if isinstance(results, tuple) else results
             if not actual:
-                self._last_fallback = self.smart_fallback.analyze_empty_result(
+                fallback = self.smart_fallback.analyze_empty_result(
                     pattern=pattern,
                     tool_name="search_functions",
                     symbol_store=self.symbol_store,
@@ -160,10 +231,10 @@ class QueryEngine:
                     namespace=namespace,
                     class_name=class_name,
                 )
-            return results
+            return results, fallback
         except re.error as e:
             diagnostics.error(f"Invalid regex pattern: {e}")
-            return []
+            return [], None
 
     def get_stats(self) -> Dict[str, Any]:
         """Get indexer statistics"""
@@ -183,18 +254,60 @@ class QueryEngine:
 
     def get_class_info(self, class_name: str) -> Optional[Dict[str, Any]]:
         """Get detailed information about a specific class, including direct derived classes."""
+        return self.cached(
+            "get_class_info", (class_name,), lambda: self._get_class_info(class_name)
+        )
+
+    def _get_class_info(self, class_name: str) -> Optional[Dict[str, Any]]:
         result = self.search_engine.get_class_info(class_name)
         if result and "error" not in result:
             # Append direct derived classes (project_only=True by default)
             # Use qualified_name for accurate lookup when available
             lookup_name = result.get("qualified_name") or class_name
-            result["derived_classes"] = get_derived_classes(
-                lookup_name,
+            result["derived_classes"] = self.get_derived_classes(lookup_name, project_only=True)
+        return result
+
+    def get_class_info_batch(self, class_names: List[str]) -> Dict[str, Any]:
+        """get_class_info for several classes, answered in one pass under the index lock.
+
+        Each name is resolved once (through the per-USR payload memo); the
+        inheritance closure is fetched once and the derived classes of all
+        found classes are collected together, so a subclass shared by several
+        of them is looked up once.  Each entry carries the requested
+        ``class_name``; classes that are not found or are ambiguous get a
+        per-entry error instead of failing the whole request.
+        """
+        names = list(dict.fromkeys(class_names))
+        with self.concurrency.index_lock:
+            infos = {name: self.search_engine.get_class_info(name) for name in names}
+            lookup_names = {
+                name: info.get("qualified_name") or name
+                for name, info in infos.items()
+                if info and "error" not in info
+            }
+            derived = get_derived_classes_many(
+                lookup_names.values(),
                 project_only=True,
+                closure=self.get_inheritance_closure(),
                 symbol_store=self.symbol_store,
                 index_lock=self.concurrency.index_lock,
             )
-        return result
+
+        entries = []
+        for name in names:
+            info = infos[name]
+            if info is None:
+                entry = {"class_name": name, "error": f"Class '{name}' not found"}
+            else:
+                entry = {"class_name": name, **info}
+                if name in lookup_names:
+                    entry["derived_classes"] = derived[lookup_names[name]]
+            entries.append(entry)
+        return {
+            "classes": entries,
+            "total": len(entries),
+            "found": sum(1 for entry in entries if "error" not in entry),
+        }
 
     def get_function_signature(
         self, function_name: str, class_name: Optional[str] = None
@@ -212,9 +325,21 @@ class QueryEngine:
         signature_pattern: Optional[str] = None,
     ):
         """Search for all symbols (classes and functions) matching pattern."""
+        args = (pattern, project_only, symbol_types, namespace, max_results, signature_pattern)
+        return self._cached_search("search_symbols", args, lambda: self._search_symbols(*args))
+
+    def _search_symbols(
+        self,
+        pattern: str,
+        project_only: bool,
+        symbol_types: Optional[List[str]],
+        namespace: Optional[str],
+        max_results: Optional[int],
+        signature_pattern: Optional[str],
+    ) -> Tuple[Any, Optional[FallbackResult]]:
         from .._core import diagnostics
 
-        self._last_fallback = None
+        fallback = None
         try:
             criteria = SearchCriteria(
                 pattern=pattern,
@@ -231,21 +356,26 @@ class QueryEngine:
             else:
                 count = len(actual) if actual else 0
             if count == 0:
-                self._last_fallback = self.smart_fallback.analyze_empty_result(
+                fallback = self.smart_fallback.analyze_empty_result(
                     pattern=pattern,
                     tool_name="search_symbols",
                     symbol_store=self.symbol_store,
                     namespace=namespace,
                 )
-            return results
+            return results, fallback
         except re.error as e:
             diagnostics.error(f"Invalid regex pattern: {e}")
-            return {"classes": [], "functions": []}
+            return {"classes": [], "functions": []}, None
 
     def get_type_alias_info(self, type_name: str) -> Dict[str, Any]:
         """Get comprehensive type alias information."""
         return get_type_alias_info(type_name, self)
 
+    def list_namespaces(self, project_only: bool = True, parent: str = "") -> Dict[str, Any]:
+        """List namespaces with class/function counts (answered from the namespace trees)."""
+        namespaces = self.symbol_store.list_namespaces(project_only, parent)
+        return {"namespaces": namespaces, "count": len(namespaces)}
+
     def find_in_file(self, file_path: str, pattern: str) -> Dict[str, Any]:
         """Search for symbols within a specific file or files matching a glob pattern."""
         return find_in_file(file_path, pattern, self, self.search_engine)
@@ -285,6 +415,7 @@ class QueryEngine:
         return get_derived_classes(
             class_name,
             project_only=project_only,
+            closure=self.get_inheritance_closure(),
             symbol_store=self.symbol_store,
             index_lock=self.concurrency.index_lock,
         )
@@ -304,4 +435,38 @@ class QueryEngine:
             direction=direction,
             symbol_store=self.symbol_store,
             index_lock=self.concurrency.index_lock,
+            memo=self._hierarchy_memo,
+            closure=self.get_inheritance_closure(),
+        )
+
+    def get_inheritance_closure(self) -> InheritanceClosure:
+        """Return the transitive inheritance closure for the current index generation."""
+        with self.concurrency.index_lock:
+            cached = self._inheritance_closure
+            generation = self.symbol_store.generation
+            if cached is None or cached[0] != generation:
+                lock = self.concurrency.index_lock
+                changes = None
+                if cached is not None:
+                    changes = self.symbol_store.get_class_changes_since(cached[1])
+                if not isinstance(changes, ClassChanges):
+                    closure = InheritanceClosure.build(
+                        self.symbol_store, lock, self._hierarchy_memo
+                    )
+                else:
+                    closure = cached[2].updated(
+                        changes, self.symbol_store, lock, self._hierarchy_memo
+                    )
+                cached = (generation, self.symbol_store.class_change_version(), closure)
+                self._inheritance_closure = cached
+            return cached[2]
+
+    def get_class_hierarchy_stats(
+        self, limit: int = 10, project_only: bool = True
+    ) -> Dict[str, Any]:
+        """Inheritance depth, fan-out and the widest base classes of the project."""
+        return self.cached(
+            "get_class_hierarchy_stats",
+            (limit, project_only),
+            lambda: self.get_inheritance_closure().stats(limit, project_only),
         )
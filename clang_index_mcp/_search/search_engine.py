@@ -1,9 +1,10 @@
 """Search functionality for C++ symbols."""
 
 import threading
-from typing import TYPE_CHECKING, Any, Dict, List, Optional, Tuple, Union, cast
+from typing import TYPE_CHECKING, Any, Dict, Iterable, List, Optional, Set, Tuple, Union, cast
 
 from .._core.regex_validator import RegexValidator
+from .._search.class_info_memo import ClassInfoMemo
 from .._search.search_criteria import SearchCriteria
 from .._symbols.model import (
     SymbolInfo,
@@ -12,8 +13,11 @@ from .._symbols.model import (
     is_richer_definition,
     omit_empty,
 )
+from .parallel_search import ParallelFunctionSearch
 from .pattern_matcher import detect_pattern_type, matches_qualified_pattern
 from .prototype_builder import build_attributes, build_class_prototype, build_function_prototype
+from .signature_index import SignaturePattern, SignatureTokenIndex, expand_signature_pattern
+from .symbol_filters import matches_function_criteria, matches_namespace
 from .symbol_name_utils import extract_simple_name, strip_template_args
 
 if TYPE_CHECKING:
@@ -34,6 +38,7 @@ class SearchEngine:
         index_lock: Optional[threading.RLock] = None,
         cache_manager=None,  # Phase 1.3: Type Alias Tracking support
         symbol_store: Optional["SymbolIndexStore"] = None,
+        parallel_search: Optional[ParallelFunctionSearch] = None,
     ):
         if symbol_store is not None:
             self.symbol_store = symbol_store
@@ -55,6 +60,12 @@ class SearchEngine:
             self.usr_index = usr_index
             self.index_lock = index_lock
         self.cache_manager = cache_manager  # Phase 1.3: For alias lookups
+        # Sharded verification for full function_index scans (store-backed only)
+        self.parallel_search = parallel_search
+        # Token postings answering signature_pattern without a full scan
+        self.signature_index = SignatureTokenIndex()
+        # Assembled get_class_info payloads by class USR (store-backed only)
+        self.class_info_memo = ClassInfoMemo()
 
     def _resolve_specialization_of(self, primary_template_usr: Optional[str]) -> Optional[str]:
         """
@@ -104,20 +115,23 @@ class SearchEngine:
             _matches_namespace("", "") → True  (global namespace)
             _matches_namespace("ns1", "") → False  (not global namespace)
         """
-        # Empty filter matches only global namespace (empty symbol_namespace)
-        if filter_namespace == "":
-            return symbol_namespace == ""
+        return matches_namespace(symbol_namespace, filter_namespace)
 
-        # Exact match
-        if symbol_namespace == filter_namespace:
-            return True
-
-        # Suffix match: symbol_namespace ends with "::filter_namespace"
-        suffix = "::" + filter_namespace
-        if symbol_namespace.endswith(suffix):
-            return True
+    def _namespace_candidates(
+        self, namespace: Optional[str], classes: bool
+    ) -> Optional[List[SymbolInfo]]:
+        """Return the symbols a namespace filter can match, from the store's namespace tree.
 
-        return False
+        Returns None when there is no namespace filter or no store-backed tree
+        (the caller scans the whole index).
+        """
+        if namespace is None or self.symbol_store is None:
+            return None
+        get_trees = getattr(self.symbol_store, "get_namespace_trees", None)
+        if get_trees is None:
+            return None
+        class_tree, function_tree = get_trees()
+        return (class_tree if classes else function_tree).symbols_in(namespace)
 
     def _matches_class_criteria(
         self,
@@ -194,18 +208,20 @@ class SearchEngine:
         results: List[Dict[str, Any]] = []
 
         with self.index_lock:
-            for name, infos in self.class_index.items():
-                for info in infos:
-                    if self._matches_class_criteria(
-                        info,
-                        pattern,
-                        criteria.project_only,
-                        criteria.file_name,
-                        criteria.namespace,
-                    ):
-                        results.append(
-                            self._create_class_result(info, criteria.include_base_classes)
-                        )
+            candidates: Optional[Iterable[SymbolInfo]] = self._namespace_candidates(
+                criteria.namespace, classes=True
+            )
+            if candidates is None:
+                candidates = (info for infos in self.class_index.values() for info in infos)
+            for info in candidates:
+                if self._matches_class_criteria(
+                    info,
+                    pattern,
+                    criteria.project_only,
+                    criteria.file_name,
+                    criteria.namespace,
+                ):
+                    results.append(self._create_class_result(info, criteria.include_base_classes))
 
         return self._apply_max_results(results, criteria.max_results)
 
@@ -217,47 +233,12 @@ class SearchEngine:
         project_only: bool,
         class_name: Optional[str],
         namespace: Optional[str],
-        signature_pattern: Optional[str],
+        signature_pattern: Optional[SignaturePattern],
     ) -> bool:
         """Helper to check if a function symbol matches the search criteria."""
-        if info.kind not in ("function", "method", "function_template"):
-            return False
-
-        # Use qualified pattern matching (Phase 2)
-        # Fallback to info.name if qualified_name is empty (backward compatibility)
-        qualified_name = info.qualified_name if info.qualified_name else info.name
-
-        # For backward compatibility: regex patterns can match EITHER qualified or unqualified name
-        # This allows "test.*" to match both "testFunction" and "TestClass::testMethod"
-        matches = matches_qualified_pattern(qualified_name, pattern)
-        if not matches and pattern_type == "regex":
-            # Also try matching against unqualified name for backward compatibility
-            matches = matches_qualified_pattern(info.name, pattern)
-
-        if not matches:
-            return False
-
-        if project_only and not info.is_project:
-            return False
-
-        # Filter by class name if specified
-        if class_name and info.parent_class != class_name:
-            return False
-
-        # Filter by namespace if specified (supports partial matching)
-        if namespace is not None:
-            if not self._matches_namespace(info.namespace, namespace):
-                return False
-
-        # Filter by prototype substring (case-insensitive)
-        # Prototype supersedes raw signature: contains return type,
-        # qualified name, params, const/virtual/static qualifiers.
-        if signature_pattern is not None:
-            prototype = build_function_prototype(info) or ""
-            if signature_pattern.lower() not in prototype.lower():
-                return False
-
-        return True
+        return matches_function_criteria(
+            info, pattern, pattern_type, project_only, class_name, namespace, signature_pattern
+        )
 
     def _create_function_result(self, info: SymbolInfo, include_attributes: bool) -> Dict[str, Any]:
         """Build a result dictionary for a function search hit."""
@@ -286,7 +267,7 @@ class SearchEngine:
         project_only: bool,
         class_name: Optional[str],
         namespace: Optional[str],
-        signature_pattern: Optional[str],
+        signature_pattern: Optional[SignaturePattern],
         file_name: str,
         include_attributes: bool,
     ) -> List[Dict[str, Any]]:
@@ -316,24 +297,52 @@ class SearchEngine:
         project_only: bool,
         class_name: Optional[str],
         namespace: Optional[str],
-        signature_pattern: Optional[str],
+        signature_pattern: Optional[SignaturePattern],
         include_attributes: bool,
     ) -> List[Dict[str, Any]]:
-        """Search for functions in function_index."""
+        """Search for functions in function_index.
+
+        Narrows the scan through the signature token index or the namespace
+        tree when the criteria allow it, and otherwise verifies the whole
+        index (sharded across workers if parallel search is enabled).
+        """
+        candidates: Optional[Iterable[SymbolInfo]] = None
+        if signature_pattern and self.symbol_store is not None:
+            candidates = self.signature_index.candidates(self.symbol_store, signature_pattern)
+        if candidates is None:
+            with self.index_lock:
+                candidates = self._namespace_candidates(namespace, classes=False)
+
+        if (
+            candidates is None
+            and self.parallel_search is not None
+            and self.symbol_store is not None
+        ):
+            matched = self.parallel_search.search(
+                self.symbol_store,
+                (pattern, pattern_type, project_only, class_name, namespace, signature_pattern),
+            )
+            if matched is not None:
+                with self.index_lock:
+                    return [
+                        self._create_function_result(info, include_attributes) for info in matched
+                    ]
+
         results: List[Dict[str, Any]] = []
         with self.index_lock:
-            for name, infos in self.function_index.items():
-                for info in infos:
-                    if self._matches_function_criteria(
-                        info,
-                        pattern,
-                        pattern_type,
-                        project_only,
-                        class_name,
-                        namespace,
-                        signature_pattern,
-                    ):
-                        results.append(self._create_function_result(info, include_attributes))
+            if candidates is None:
+                candidates = (info for infos in self.function_index.values() for info in infos)
+            for info in candidates:
+                if self._matches_function_criteria(
+                    info,
+                    pattern,
+                    pattern_type,
+                    project_only,
+                    class_name,
+                    namespace,
+                    signature_pattern,
+                ):
+                    results.append(self._create_function_result(info, include_attributes))
         return results
 
     @staticmethod
@@ -379,6 +388,10 @@ class SearchEngine:
         if class_name:
             class_name = extract_simple_name(class_name)
 
+        signature_pattern: Optional[SignaturePattern] = criteria.signature_pattern
+        if signature_pattern:
+            signature_pattern = expand_signature_pattern(signature_pattern, self.cache_manager)
+
         if criteria.file_name:
             results = self._search_functions_in_file_index(
                 pattern,
@@ -386,7 +399,7 @@ class SearchEngine:
                 criteria.project_only,
                 class_name,
                 criteria.namespace,
-                criteria.signature_pattern,
+                signature_pattern,
                 criteria.file_name,
                 criteria.include_attributes,
             )
@@ -397,7 +410,7 @@ class SearchEngine:
                 criteria.project_only,
                 class_name,
                 criteria.namespace,
-                criteria.signature_pattern,
+                signature_pattern,
                 criteria.include_attributes,
             )
 
@@ -584,9 +597,16 @@ class SearchEngine:
         }
 
     def _find_class_methods(
-        self, simple_name: str, class_qualified_name: Optional[str]
+        self,
+        simple_name: str,
+        class_qualified_name: Optional[str],
+        files: Optional[Set[str]] = None,
     ) -> List[Dict[str, Any]]:
-        """Find all methods belonging to a specific class."""
+        """Find all methods belonging to a specific class.
+
+        Args:
+            files: If given, receives the files the methods were found in.
+        """
         methods = []
         for name, func_infos in self.function_index.items():
             for func_info in func_infos:
@@ -604,6 +624,8 @@ class SearchEngine:
                 else:
                     continue
 
+                if files is not None:
+                    files.update((func_info.file, func_info.header_file or ""))
                 methods.append(
                     omit_empty(
                         {
@@ -627,6 +649,9 @@ class SearchEngine:
     def get_class_info(self, class_name: str) -> Optional[Dict[str, Any]]:
         """Get detailed information about a class.
 
+        Payloads are memoized per class USR until one of the files they were
+        built from changes (see ClassInfoMemo).
+
         Args:
             class_name: Simple name (e.g., "Widget") or qualified name
                        (e.g., "myapp::builders::Widget")
@@ -650,6 +675,13 @@ class SearchEngine:
                 return candidate  # Ambiguity error
 
             info: SymbolInfo = candidate
+            memo = self.class_info_memo if self.symbol_store is not None and info.usr else None
+            if memo is not None:
+                memo.sync(self.symbol_store)
+                cached = memo.get(info.usr)  # type: ignore[arg-type]
+                if cached is not None:
+                    return cached
+
             simple_name = extract_simple_name(info.name)
 
             # For method lookup, we need to match parent_class
@@ -658,7 +690,19 @@ class SearchEngine:
             class_qualified_name = info.qualified_name
 
             # Find all methods of this class
-            methods = self._find_class_methods(simple_name, class_qualified_name)
+            files = {info.file, info.header_file or ""}
+            methods = self._find_class_methods(simple_name, class_qualified_name, files)
+            result = self._build_class_info(info, methods)
+
+            if memo is not None:
+                primary = self.usr_index.get(info.primary_template_usr or "")
+                if primary is not None:
+                    files.add(primary.file)
+                memo.put(info, result, files)
+            return result
+
+    def _build_class_info(self, info: SymbolInfo, methods: List[Dict[str, Any]]) -> Dict[str, Any]:
+        """Assemble the get_class_info payload of a class and its methods."""
 
         def _method_sort_line(m: Dict[str, Any]) -> int:
             """Extract line number for sorting from declaration or definition."""
@@ -0,0 +1,210 @@
+"""Inverted token index over function prototypes for signature_pattern search.
+
+signature_pattern is a case-insensitive substring match against the function
+prototype, so answering it naively means building and scanning the prototype
+of every function in the index.  SignatureTokenIndex tokenizes each prototype
+once into lowercase identifier tokens (type names, qualifiers, parameter
+names) and keeps a posting list per token.  When the store changes, only the
+functions added since are tokenized (see FunctionSnapshot).
+
+A pattern is turned into token constraints: tokens enclosed by punctuation or
+spaces inside the pattern must appear verbatim in the prototype, while tokens
+touching either end of the pattern may be cut off mid-token and are matched
+against the token vocabulary by prefix/suffix/substring.  Intersecting the
+postings yields a candidate superset that is then verified with the regular
+substring check, so results are identical to a full scan.
+
+Type aliases are expanded on the query side (expand_signature_pattern): a
+pattern naming an alias also matches prototypes spelling its canonical type,
+and vice versa.
+"""
+
+import re
+import threading
+from array import array
+from typing import TYPE_CHECKING, Dict, List, Optional, Set, Tuple, Union
+
+from .._core import diagnostics
+from .._symbols.model import SymbolInfo
+from .function_snapshot import FunctionSnapshot
+from .prototype_builder import build_function_prototype
+from .type_alias_expander import TypeAliasExpander
+
+if TYPE_CHECKING:
+    from .._symbols.symbol_index_store import SymbolIndexStore
+
+# A signature_pattern, or a tuple of alternatives produced by alias expansion.
+SignaturePattern = Union[str, Tuple[str, ...]]
+
+_TOKEN_RE = re.compile(r"[a-z0-9_]+")
+_TYPE_NAME_RE = re.compile(r"[A-Za-z_]\w*(?:::[A-Za-z_]\w*)*")
+
+# Tokens present in more than this fraction of all functions ("const", "void",
+# "public", ...) do not narrow the candidate set; no postings are kept for them.
+_COMMON_TOKEN_FRACTION = 4
+
+# Stop intersecting once the candidate set is this small; verification of a
+# handful of prototypes is cheaper than scanning the vocabulary for edge tokens.
+_SMALL_CANDIDATE_SET = 64
+
+# Upper bound on alternatives produced by alias expansion of one pattern.
+_MAX_PATTERN_VARIANTS = 16
+
+
+def signature_tokens(text: str) -> Set[str]:
+    """Return the set of lowercase identifier tokens of a prototype or type."""
+    return set(_TOKEN_RE.findall(text.lower()))
+
+
+def expand_signature_pattern(pattern: str, cache_manager) -> SignaturePattern:
+    """Expand type aliases named in a signature pattern.
+
+    The pattern as a whole and every (possibly qualified) type name in it are
+    replaced in turn by their canonical type and other aliases, e.g. "const ErrorCallback &"
+    also yields "const std::function<void(const Error &)> &".
+
+    Returns:
+        The pattern unchanged if nothing expands, otherwise a tuple of
+        alternatives starting with the original pattern.
+    """
+    if not pattern or cache_manager is None:
+        return pattern
+
+    expander = TypeAliasExpander(cache_manager)
+    variants = [pattern]
+    # The whole pattern may itself spell a canonical type such as a template
+    # instantiation that no single name inside it covers.
+    type_names = [pattern.strip()] + [m.group(0) for m in _TYPE_NAME_RE.finditer(pattern)]
+    for type_name in dict.fromkeys(type_names):
+        for alternative in expander.expand_type_name(type_name)[1:]:
+            if not isinstance(alternative, str):
+                continue
+            for variant in list(variants):
+                expanded = variant.replace(type_name, alternative)
+                if expanded not in variants:
+                    variants.append(expanded)
+                if len(variants) >= _MAX_PATTERN_VARIANTS:
+                    return tuple(variants)
+    return tuple(variants) if len(variants) > 1 else pattern
+
+
+class SignatureTokenIndex:
+    """Token -> function postings over prototypes, kept up to date with the store."""
+
+    def __init__(self) -> None:
+        self._lock = threading.Lock()
+        # Postings hold positions into the snapshot's function list
+        self._snapshot = FunctionSnapshot()
+        self._postings: Dict[str, array] = {}
+        self._common: Set[str] = set()
+
+    def candidates(
+        self, store: "SymbolIndexStore", signature_pattern: SignaturePattern
+    ) -> Optional[List[SymbolInfo]]:
+        """Return function symbols that may match signature_pattern.
+
+        The result is a superset of the matches, in function_index order.
+        Returns None if the pattern has no usable token (the caller must scan).
+        """
+        variants = (
+            (signature_pattern,) if isinstance(signature_pattern, str) else signature_pattern
+        )
+        with self._lock:
+            with store.index_lock:
+                self._refresh(store)
+            positions: Set[int] = set()
+            for variant in variants:
+                matched = self._positions_for(variant.lower())
+                if matched is None:
+                    return None
+                positions |= matched
+            with store.index_lock:
+                return self._snapshot.in_index_order(store, positions)
+
+    def _refresh(self, store: "SymbolIndexStore") -> None:
+        """Bring the postings up to date with the store (call under index_lock)."""
+        start = self._snapshot.sync(store)
+        functions = self._snapshot.functions
+        if start is not None:
+            # Tokens common at the last rebuild stay common
+            for pos in range(start, len(functions)):
+                for token in signature_tokens(build_function_prototype(functions[pos]) or ""):
+                    if token not in self._common:
+                        self._postings.setdefault(token, array("I")).append(pos)
+            return
+
+        postings: Dict[str, List[int]] = {}
+        for pos, info in enumerate(functions):
+            for token in signature_tokens(build_function_prototype(info) or ""):
+                postings.setdefault(token, []).append(pos)
+
+        common_limit = max(len(functions) // _COMMON_TOKEN_FRACTION, _SMALL_CANDIDATE_SET)
+        self._common = {token for token, pos in postings.items() if len(pos) > common_limit}
+        self._postings = {
+            token: array("I", pos) for token, pos in postings.items() if token not in self._common
+        }
+        diagnostics.debug(
+            f"Signature index: {len(functions)} functions, {len(postings)} tokens "
+            f"({len(self._common)} common) at generation {self._snapshot.generation}"
+        )
+
+    def _positions_for(self, pattern: str) -> Optional[Set[int]]:
+        """Intersect the postings of the pattern's tokens (pattern is lowercase)."""
+        exact: List[str] = []
+        partial: List[Tuple[str, bool, bool]] = []
+        for match in _TOKEN_RE.finditer(pattern):
+            open_start = match.start() == 0
+            open_end = match.end() == len(pattern)
+            if open_start or open_end:
+                partial.append((match.group(0), open_start, open_end))
+            else:
+                exact.append(match.group(0))
+
+        result: Optional[Set[int]] = None
+        for token in exact:
+            if token in self._common:
+                continue
+            result = self._intersect(result, set(self._postings.get(token, ())))
+            if len(result) <= _SMALL_CANDIDATE_SET:
+                return result
+
+        for token, open_start, open_end in partial:
+            matched = self._vocabulary_positions(token, open_start, open_end)
+            if matched is None:
+                continue
+            result = self._intersect(result, matched)
+            if len(result) <= _SMALL_CANDIDATE_SET:
+                return result
+        return result
+
+    def _vocabulary_positions(
+        self, fragment: str, open_start: bool, open_end: bool
+    ) -> Optional[Set[int]]:
+        """Union the postings of tokens containing a pattern-edge fragment.
+
+        Returns None if a common token matches (no narrowing possible).
+        """
+        if open_start and open_end:
+            matches = [t for t in self._common if fragment in t]
+        elif open_start:
+            matches = [t for t in self._common if t.endswith(fragment)]
+        else:
+            matches = [t for t in self._common if t.startswith(fragment)]
+        if matches:
+            return None
+
+        positions: Set[int] = set()
+        for token, pos in self._postings.items():
+            if open_start and open_end:
+                hit = fragment in token
+            elif open_start:
+                hit = token.endswith(fragment)
+            else:
+                hit = token.startswith(fragment)
+            if hit:
+                positions.update(pos)
+        return positions
+
+    @staticmethod
+    def _intersect(current: Optional[Set[int]], positions: Set[int]) -> Set[int]:
+        return positions if current is None else current & positions
@@ -7,15 +7,23 @@ to detect common LLM mistakes and generate actionable suggestions:
 - Regex anchoring issues (fullmatch semantics)
 - Qualified name with wrong namespace
 - File name case mismatch
+- Misspelled name (edit-distance suggestions)
 
 Design: Fallback cascade runs in priority order, first match wins.
-Performance: Only called when results are empty. Uses O(1) index lookups, not full scans.
+Performance: Only called when results are empty. Candidates come from NameLookup
+(lowercase name map, edit enumeration, literal-pruned regex checks) rather than
+full scans, and each analysis stops trying further detectors once its time
+budget is spent.
 """
 
 import re
+import threading
+import time
 from dataclasses import dataclass, field
 from pathlib import Path
-from typing import Any, Dict, List, Optional
+from typing import Any, Dict, List, Optional, Sequence, Tuple
+
+from .name_lookup import NameLookup
 
 
 @dataclass
@@ -171,68 +179,71 @@ def _looks_like_short_regex(pattern: str) -> bool:
         return False
 
 
+def _format_alternatives(symbols: Sequence[Any]) -> List[Dict[str, Any]]:
+    """Format symbols as fallback alternatives."""
+    return [
+        {
+            "name": info.name,
+            "qualified_name": getattr(info, "qualified_name", info.name),
+            "file": info.file,
+            "line": info.line,
+        }
+        for info in symbols
+    ]
+
+
+def _qualified_suffix_score(info: Any, components: List[str]) -> int:
+    """Count trailing qualified-name components shared with the searched pattern."""
+    qualified = (getattr(info, "qualified_name", None) or info.name).lower().split("::")
+    score = 0
+    for have, want in zip(reversed(qualified), reversed(components)):
+        if have != want.lower():
+            break
+        score += 1
+    return score
+
+
 def _index_lookup_simple(
-    index: Dict[str, List[Any]], name: str, max_results: int = 10
+    lookup: NameLookup, name: str, max_results: int = 10, qualified_pattern: str = ""
 ) -> List[Dict[str, Any]]:
-    """Look up a simple name in an index, return formatted alternatives."""
-    name_lower = name.lower()
-    candidates = index.get(name, [])
-    # Also try case-insensitive
-    if not candidates:
-        for key, infos in index.items():
-            if key.lower() == name_lower:
-                candidates = infos
-                break
-    results = []
-    for info in candidates[:max_results]:
-        results.append(
-            {
-                "name": info.name,
-                "qualified_name": getattr(info, "qualified_name", info.name),
-                "file": info.file,
-                "line": info.line,
-            }
-        )
-    return results
+    """Look up a simple name (exact, then case-insensitive), return formatted alternatives.
+
+    With qualified_pattern, symbols sharing the longest namespace suffix with
+    the pattern are listed first.
+    """
+    if not qualified_pattern:
+        return _format_alternatives(lookup.symbols(name, max_results))
+    components = qualified_pattern.split("::")
+    candidates = sorted(
+        lookup.symbols(name, max_results=10_000),
+        key=lambda info: -_qualified_suffix_score(info, components),
+    )
+    return _format_alternatives(candidates[:max_results])
 
 
 def _sample_regex_matches(
-    index: Dict[str, List[Any]],
+    lookup: NameLookup,
     pattern: str,
-    max_sample: int = 200,
+    deadline: float,
     max_results: int = 10,
 ) -> List[Dict[str, Any]]:
-    """Test a regex pattern against a sample of index entries.
+    """Test a regex pattern against index entries whose names could match.
 
-    Returns matching alternatives. Bounded to max_sample entries for performance.
+    Returns matching alternatives. Bounded by max_results and the deadline.
     """
     try:
         compiled = re.compile(pattern, re.IGNORECASE)
     except re.error:
         return []
 
-    results = []
-    checked = 0
-    for name, infos in index.items():
-        if checked >= max_sample:
-            break
-        for info in infos:
-            checked += 1
-            if checked >= max_sample:
+    matches = []
+    for info in lookup.regex_candidates(pattern, deadline):
+        qualified = getattr(info, "qualified_name", info.name)
+        if compiled.fullmatch(qualified) or compiled.fullmatch(info.name):
+            matches.append(info)
+            if len(matches) >= max_results:
                 break
-            qualified = getattr(info, "qualified_name", info.name)
-            if compiled.fullmatch(qualified) or compiled.fullmatch(info.name):
-                results.append(
-                    {
-                        "name": info.name,
-                        "qualified_name": qualified,
-                        "file": info.file,
-                        "line": info.line,
-                    }
-                )
-                if len(results) >= max_results:
-                    return results
-    return results
+    return _format_alternatives(matches)
 
 
 class SmartFallback:
@@ -242,6 +253,18 @@ class SmartFallback:
     fallback cascade to detect common LLM mistakes and suggest corrections.
     """
 
+    def __init__(self, time_budget_ms: float = 50.0):
+        """
+        Args:
+            time_budget_ms: Wall-clock budget for one analysis. Detectors that
+                would start after it is spent are skipped, and regex/edit
+                distance candidate generation stops at the deadline.
+        """
+        self.time_budget_ms = time_budget_ms
+        self._lookup_lock = threading.Lock()
+        # kind -> (namespace tree versions, NameLookup) for store-backed analyses
+        self._lookups: Dict[str, Tuple[Tuple[int, ...], NameLookup]] = {}
+
     def analyze_empty_result(
         self,
         pattern: str,
@@ -281,40 +304,83 @@ class SmartFallback:
         if not pattern:
             return None
 
+        deadline = time.monotonic() + self.time_budget_ms / 1000.0
+
         # Select the appropriate index for the tool
+        function_lookup = self._get_lookup("function", [function_index], symbol_store)
         if tool_name == "search_classes":
-            primary_index = class_index
+            primary = self._get_lookup("class", [class_index], symbol_store)
         elif tool_name == "search_functions":
-            primary_index = function_index
+            primary = function_lookup
         else:
-            # search_symbols uses both — merge for lookup purposes
-            primary_index = {**class_index, **function_index}
+            # search_symbols uses both
+            primary = self._get_lookup("all", [class_index, function_index], symbol_store)
 
         # Cascade: try each detector in priority order
-        result = self._detect_signature(pattern, primary_index, function_index)
+        result = self._detect_signature(pattern, primary, function_lookup)
         if result:
             return result
 
-        result = self._detect_regex_issues(pattern, primary_index)
+        if time.monotonic() > deadline:
+            return None
+        result = self._detect_regex_issues(pattern, primary, deadline)
         if result:
             return result
 
-        result = self._detect_qualified_fallback(pattern, primary_index)
+        if time.monotonic() > deadline:
+            return None
+        result = self._detect_qualified_fallback(pattern, primary, deadline)
         if result:
             return result
 
         if file_name and file_index:
-            result = self._detect_file_case_mismatch(pattern, file_name, file_index, primary_index)
+            result = self._detect_file_case_mismatch(pattern, file_name, file_index)
             if result:
                 return result
 
-        return None
+        if time.monotonic() > deadline:
+            return None
+        return self._detect_misspelling(pattern, primary, deadline)
+
+    def _get_lookup(
+        self, kind: str, indexes: List[Dict[str, List[Any]]], symbol_store
+    ) -> NameLookup:
+        """Return the NameLookup for indexes, caught up with the store's changes since last use.
+
+        The namespace trees of the store journal the symbols added to and
+        removed from each index; the lookup is rebuilt only when they can no
+        longer say what changed.
+        """
+        if symbol_store is None:
+            return NameLookup(indexes)
+        with self._lookup_lock, symbol_store.index_lock:
+            class_tree, function_tree = symbol_store.get_namespace_trees()
+            trees = {
+                "class": (class_tree,),
+                "function": (function_tree,),
+                "all": (class_tree, function_tree),
+            }[kind]
+            versions = tuple(tree.version for tree in trees)
+            cached = self._lookups.get(kind)
+            if cached is not None:
+                changes = [tree.changes_since(v) for tree, v in zip(trees, cached[0])]
+                if all(change is not None for change in changes):
+                    lookup = cached[1]
+                    lookup.update(
+                        (info.name for change in changes for info in change.added),
+                        (info.name for change in changes for info in change.removed),
+                    )
+                    self._lookups[kind] = (versions, lookup)
+                    return lookup
+            lookup = NameLookup(indexes)
+            self._lookups[kind] = (versions, lookup)
+            return lookup
 
     def _detect_signature(
         self,
         pattern: str,
-        primary_index: Dict[str, List[Any]],
-        function_index: Dict[str, List[Any]],
+        primary: NameLookup,
+        function_lookup: NameLookup,
     ) -> Optional[FallbackResult]:
         """Detect signature/prototype used as pattern instead of symbol name."""
         if not looks_like_signature(pattern):
@@ -333,9 +399,9 @@ class SmartFallback:
             )
 
         # Try to find the extracted name in the index
-        alternatives = _index_lookup_simple(function_index, extracted)
+        alternatives = _index_lookup_simple(function_lookup, extracted)
         if not alternatives:
-            alternatives = _index_lookup_simple(primary_index, extracted)
+            alternatives = _index_lookup_simple(primary, extracted)
 
         return FallbackResult(
             reason="signature_detected",
@@ -349,36 +415,36 @@ class SmartFallback:
         )
 
     def _detect_regex_issues(
-        self, pattern: str, primary_index: Dict[str, List[Any]]
+        self, pattern: str, primary: NameLookup, deadline: float
     ) -> Optional[FallbackResult]:
         """Detect regex anchoring issues, double escapes, etc."""
         regex_chars = set(".*+?[]{}()|\\^$")
         if not any(c in pattern for c in regex_chars):
             return None
 
-        result = self._check_double_escapes(pattern, primary_index)
+        result = self._check_double_escapes(pattern, primary, deadline)
         if result:
             return result
 
-        result = self._check_unnecessary_anchors(pattern, primary_index)
+        result = self._check_unnecessary_anchors(pattern, primary, deadline)
         if result:
             return result
 
-        result = self._check_short_regex(pattern, primary_index)
+        result = self._check_short_regex(pattern, primary, deadline)
         if result:
             return result
 
-        return self._check_generic_broadening(pattern, primary_index)
+        return self._check_generic_broadening(pattern, primary, deadline)
 
     def _check_double_escapes(
-        self, pattern: str, primary_index: Dict[str, List[Any]]
+        self, pattern: str, primary: NameLookup, deadline: float
     ) -> Optional[FallbackResult]:
         """Check for double-escaped regex characters."""
         if not _has_double_escapes(pattern):
             return None
 
         fixed = pattern.replace("\\\\", "\\")
-        alternatives = _sample_regex_matches(primary_index, fixed)
+        alternatives = _sample_regex_matches(primary, fixed, deadline)
         if alternatives:
             return FallbackResult(
                 reason="regex_hint",
@@ -393,7 +459,7 @@ class SmartFallback:
         return None
 
     def _check_unnecessary_anchors(
-        self, pattern: str, primary_index: Dict[str, List[Any]]
+        self, pattern: str, primary: NameLookup, deadline: float
     ) -> Optional[FallbackResult]:
         """Check for unnecessary ^ and $ anchors in regex patterns."""
         if not _has_unnecessary_anchors(pattern):
@@ -406,9 +472,9 @@ class SmartFallback:
         if pattern.startswith("^") and not stripped.endswith(".*"):
             suggested = suggested + ".*"
 
-        alternatives = _sample_regex_matches(primary_index, suggested)
+        alternatives = _sample_regex_matches(primary, suggested, deadline)
         if not alternatives:
-            alternatives = _sample_regex_matches(primary_index, stripped)
+            alternatives = _sample_regex_matches(primary, stripped, deadline)
             if alternatives:
                 suggested = stripped
 
@@ -427,14 +493,14 @@ class SmartFallback:
         return None
 
     def _check_short_regex(
-        self, pattern: str, primary_index: Dict[str, List[Any]]
+        self, pattern: str, primary: NameLookup, deadline: float
     ) -> Optional[FallbackResult]:
         """Check for short regex patterns that may need broadening."""
         if not _looks_like_short_regex(pattern):
             return None
 
         broadened = pattern + ".*"
-        alternatives = _sample_regex_matches(primary_index, broadened)
+        alternatives = _sample_regex_matches(primary, broadened, deadline)
         if alternatives:
             return FallbackResult(
                 reason="regex_hint",
@@ -450,7 +516,7 @@ class SmartFallback:
         return None
 
     def _check_generic_broadening(
-        self, pattern: str, primary_index: Dict[str, List[Any]]
+        self, pattern: str, primary: NameLookup, deadline: float
     ) -> Optional[FallbackResult]:
         """Generic fallback: try broadening with .* prefix/suffix."""
         if pattern.startswith(".*"):
@@ -460,7 +526,7 @@ class SmartFallback:
         if not broadened.endswith(".*"):
             broadened = broadened + ".*"
 
-        alternatives = _sample_regex_matches(primary_index, broadened)
+        alternatives = _sample_regex_matches(primary, broadened, deadline)
         if alternatives:
             return FallbackResult(
                 reason="regex_hint",
@@ -476,7 +542,7 @@ class SmartFallback:
         return None
 
     def _detect_qualified_fallback(
-        self, pattern: str, primary_index: Dict[str, List[Any]]
+        self, pattern: str, primary: NameLookup, deadline: float
     ) -> Optional[FallbackResult]:
         """Detect wrong namespace in qualified name and suggest alternatives."""
         if "::" not in pattern:
@@ -491,9 +557,9 @@ class SmartFallback:
         if not simple_name:
             return None
 
-        alternatives = _index_lookup_simple(primary_index, simple_name)
+        alternatives = _index_lookup_simple(primary, simple_name, qualified_pattern=pattern)
         if not alternatives:
-            return None
+            return self._suggest_similar(pattern, simple_name, primary, deadline)
 
         return FallbackResult(
             reason="qualified_fallback",
@@ -512,7 +578,6 @@ class SmartFallback:
         pattern: str,
         file_name: str,
         file_index: Dict[str, List[Any]],
-        primary_index: Dict[str, List[Any]],
     ) -> Optional[FallbackResult]:
         """Detect file_name filter with wrong case."""
         file_name_lower = file_name.lower()
@@ -537,3 +602,36 @@ class SmartFallback:
             suggested_pattern=pattern,
             alternatives=[{"suggested_file_name": f} for f in matching_files[:5]],
         )
+
+    def _detect_misspelling(
+        self, pattern: str, primary: NameLookup, deadline: float
+    ) -> Optional[FallbackResult]:
+        """Suggest similarly spelled names for a plain identifier nobody is named."""
+        if not _IDENTIFIER_RE.fullmatch(pattern) or "::" in pattern:
+            return None
+        if primary.has_name(pattern):
+            return None
+        return self._suggest_similar(pattern, pattern, primary, deadline)
+
+    def _suggest_similar(
+        self, pattern: str, name: str, primary: NameLookup, deadline: float
+    ) -> Optional[FallbackResult]:
+        """Build a fuzzy_match suggestion from names within a small edit distance."""
+        similar = primary.similar_names(name, deadline)
+        if not similar:
+            return None
+
+        symbols: List[Any] = []
+        for similar_name in similar:
+            symbols.extend(primary.symbols(similar_name, max_results=10 - len(symbols)))
+            if len(symbols) >= 10:
+                break
+        suggested = pattern[: len(pattern) - len(name)] + similar[0]
+        names = ", ".join(f"'{n}'" for n in dict.fromkeys(similar[:5]))
+        return FallbackResult(
+            reason="fuzzy_match",
+            searched_for=pattern,
+            hint=f"No symbol named '{name}'. Similarly spelled names: {names}.",
+            suggested_pattern=suggested,
+            alternatives=_format_alternatives(symbols),
+        )
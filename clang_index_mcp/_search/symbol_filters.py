@@ -0,0 +1,78 @@
+"""Per-symbol filter predicates used by search.
+
+These are pure functions over SymbolInfo with no dependency on indexes or
+locks, so they can run inside search worker processes as well as in
+SearchEngine itself.
+"""
+
+from typing import Optional, Tuple, Union
+
+from .._symbols.model import FUNCTION_KINDS, SymbolInfo
+from .pattern_matcher import matches_qualified_pattern
+from .prototype_builder import build_function_prototype
+
+
+def matches_namespace(symbol_namespace: str, filter_namespace: str) -> bool:
+    """Check if symbol's namespace matches the filter namespace.
+
+    Empty filter matches only the global namespace; otherwise the filter
+    matches exactly or as a suffix at a "::" boundary.
+    """
+    if filter_namespace == "":
+        return symbol_namespace == ""
+
+    if symbol_namespace == filter_namespace:
+        return True
+
+    return symbol_namespace.endswith("::" + filter_namespace)
+
+
+def matches_function_criteria(
+    info: SymbolInfo,
+    pattern: str,
+    pattern_type: str,
+    project_only: bool,
+    class_name: Optional[str],
+    namespace: Optional[str],
+    signature_pattern: Optional[Union[str, Tuple[str, ...]]],
+) -> bool:
+    """Check if a function symbol matches the search criteria.
+
+    signature_pattern is a case-insensitive substring of the prototype, or a
+    tuple of alternative substrings (type alias expansions of one pattern).
+    """
+    if info.kind not in FUNCTION_KINDS:
+        return False
+
+    # Fallback to info.name if qualified_name is empty (backward compatibility)
+    qualified_name = info.qualified_name if info.qualified_name else info.name
+
+    # For backward compatibility: regex patterns can match EITHER qualified or unqualified name
+    # This allows "test.*" to match both "testFunction" and "TestClass::testMethod"
+    matches = matches_qualified_pattern(qualified_name, pattern)
+    if not matches and pattern_type == "regex":
+        matches = matches_qualified_pattern(info.name, pattern)
+
+    if not matches:
+        return False
+
+    if project_only and not info.is_project:
+        return False
+
+    if class_name and info.parent_class != class_name:
+        return False
+
+    if namespace is not None and not matches_namespace(info.namespace, namespace):
+        return False
+
+    # Prototype supersedes raw signature: contains return type,
+    # qualified name, params, const/virtual/static qualifiers.
+    if signature_pattern is not None:
+        prototype = (build_function_prototype(info) or "").lower()
+        if isinstance(signature_pattern, str):
+            if signature_pattern.lower() not in prototype:
+                return False
+        elif not any(p.lower() in prototype for p in signature_pattern):
+            return False
+
+    return True
@@ -4,11 +4,15 @@ Provides parsing and matching utilities for template parameters, specializations
 and indirect inheritance through template parameters (e.g. ``class Foo<T> : public T``).
 """
 
-import json
 import re
 from typing import Any, Dict, List, Optional, Set
 
-from .._symbols.model import SymbolInfo, build_location_objects, omit_empty
+from .._symbols.model import (
+    SymbolInfo,
+    build_location_objects,
+    omit_empty,
+    template_parameter_names,
+)
 from .._search.pattern_matcher import matches_qualified_pattern
 from .._search.symbol_name_utils import extract_simple_name
 
@@ -137,18 +141,9 @@ def template_info_matches_name(info: SymbolInfo, template_name: str) -> bool:
 def build_param_name_to_index(template_parameters: Optional[str]) -> Dict[str, int]:
     """Build a mapping from template parameter names to their indices."""
     param_name_to_index: Dict[str, int] = {}
-    if not template_parameters:
-        return param_name_to_index
-
-    try:
-        params = json.loads(template_parameters)
-        for i, param in enumerate(params):
-            param_name = param.get("name", "")
-            if param_name:
-                param_name_to_index[param_name] = i
-    except (json.JSONDecodeError, TypeError):
-        pass
-
+    for i, param_name in enumerate(template_parameter_names(template_parameters)):
+        if param_name:
+            param_name_to_index[param_name] = i
     return param_name_to_index
 
 
@@ -245,20 +240,19 @@ def is_derived_from(
     index_lock,
 ) -> bool:
     """Check if a symbol inherits from the target class or any specialization."""
-    tparam_names: Set[str] = set()
-    if info.template_parameters:
-        try:
-            tparams = json.loads(info.template_parameters)
-            tparam_names = {p.get("name", "") for p in tparams if p.get("name")}
-        except (json.JSONDecodeError, TypeError):
-            pass
+    tparam_names: Set[str] = set(template_parameter_names(info.template_parameters))
+    tparam_names.discard("")
 
     for base_class in info.base_classes:
         # Skip base classes that are template parameters
         if base_class in tparam_names:
             continue
 
-        match_found = check_pattern_match(base_class, template_patterns)
+        # The simple-name comparison also covers specializations whose
+        # arguments are qualified ("ns::Container<ns::Foo>")
+        match_found = extract_simple_name(base_class) == simple_name or check_pattern_match(
+            base_class, template_patterns
+        )
 
         # Issue cplusplus_mcp-hnj: Check for indirect inheritance
         # through template parameters
@@ -303,23 +297,22 @@ def get_derived_classes(
     # Issue #99 Phase 3: Check if this is a template and get all specializations
     template_patterns = get_template_patterns(simple_name, symbol_store, index_lock)
 
+    # Only classes naming simple_name (or one of its specializations) as a base,
+    # directly or as a template argument, can derive from it
     with index_lock:
-        for name, infos in symbol_store.iter_class_items():
-            for info in infos:
-                if not project_only or info.is_project:
-                    if is_derived_from(
-                        info, template_patterns, simple_name, symbol_store, index_lock
-                    ):
-                        derived_classes.append(
-                            omit_empty(
-                                {
-                                    "qualified_name": info.qualified_name or info.name,
-                                    "kind": info.kind,
-                                    "is_project": info.is_project,
-                                    "base_classes": info.base_classes,
-                                    **build_location_objects(info),
-                                }
-                            )
+        for info in symbol_store.get_derived_class_candidates(simple_name):
+            if not project_only or info.is_project:
+                if is_derived_from(info, template_patterns, simple_name, symbol_store, index_lock):
+                    derived_classes.append(
+                        omit_empty(
+                            {
+                                "qualified_name": info.qualified_name or info.name,
+                                "kind": info.kind,
+                                "is_project": info.is_project,
+                                "base_classes": info.base_classes,
+                                **build_location_objects(info),
+                            }
                         )
+                    )
 
     return derived_classes
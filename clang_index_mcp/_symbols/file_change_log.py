@@ -0,0 +1,47 @@
+"""Journal of the files whose indexed symbols changed.
+
+Structures derived from the symbols of a few files (such as the class info
+memo of the search engine) ask which files changed since they were built and
+drop only what depends on those, instead of starting over on every index
+generation.
+"""
+
+from typing import List, Optional, Set
+
+# Entries kept before consumers fall back to starting over
+_JOURNAL_LIMIT = 50000
+
+
+class FileChangeLog:
+    """Files whose symbols were added, removed or changed, in order."""
+
+    def __init__(self) -> None:
+        # Entry i has version _start + i + 1.  A reset empties the journal.
+        self._files: List[str] = []
+        self._start = 0
+
+    @property
+    def version(self) -> int:
+        """Counter advanced by every recorded change."""
+        return self._start + len(self._files)
+
+    def record(self, file_path: Optional[str]) -> None:
+        if not file_path:
+            return
+        if len(self._files) >= _JOURNAL_LIMIT:
+            dropped = _JOURNAL_LIMIT // 2
+            del self._files[:dropped]
+            self._start += dropped
+        self._files.append(file_path)
+
+    def reset(self) -> None:
+        """Forget the journal (all symbols replaced); earlier versions can no longer catch up."""
+        self._start = self.version + 1
+        self._files = []
+
+    def changed_since(self, version: int) -> Optional[Set[str]]:
+        """Files changed after version, or None if they are no longer known."""
+        start = version - self._start
+        if start < 0 or version > self.version:
+            return None
+        return set(self._files[start:])
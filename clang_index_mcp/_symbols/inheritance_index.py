@@ -0,0 +1,204 @@
+"""
+Reverse inheritance index for SymbolIndexStore.
+
+Maps a base class name to the class symbols that name it as a direct base,
+so derived-class queries look at a handful of candidates instead of every
+indexed class.  Keys are simple names with template arguments stripped, so
+classes deriving from ``Container<int>`` and ``ns::Container<Foo>`` are both
+found under ``Container`` (the primary template and all its specializations).
+Classes deriving from a template instantiation are also keyed by the
+template's arguments, for templates that inherit from a parameter
+(``class Foo<T> : public T``).
+
+The keys only select candidates; callers still check the actual relation.
+
+The index also journals every class it links or unlinks, so structures
+derived from the class graph (hierarchy memo, inheritance closure) can be
+brought up to date from the classes that changed since they were built
+instead of being recomputed (see changes_since).
+"""
+
+from collections import defaultdict
+from typing import Dict, Iterable, List, NamedTuple, Optional, Set, Tuple, Union
+
+from .._symbols.model import SymbolInfo
+
+
+def base_key(name: str) -> str:
+    """Simple name of a (possibly qualified) type name, template arguments stripped."""
+    if "<" in name and name.endswith(">"):
+        name = name[: name.index("<")]
+    return name.split("::")[-1]
+
+
+def _top_level_template_args(name: str) -> List[str]:
+    """Top-level template arguments of a type name ("A<B, C<D>>" -> ["B", "C<D>"])."""
+    if "<" not in name or not name.endswith(">"):
+        return []
+    args: List[str] = []
+    depth = 0
+    current = ""
+    for char in name[name.index("<") + 1 : -1]:
+        if char == "<":
+            depth += 1
+        elif char == ">":
+            depth -= 1
+        elif char == "," and depth == 0:
+            args.append(current.strip())
+            current = ""
+            continue
+        current += char
+    if current.strip():
+        args.append(current.strip())
+    return args
+
+
+def base_keys(info: SymbolInfo) -> Set[str]:
+    """Reverse index keys of a class: its base names and their template arguments."""
+    keys: Set[str] = set()
+    for base in info.base_classes:
+        keys.add(base_key(base))
+        for arg in _top_level_template_args(base):
+            keys.add(base_key(arg))
+    keys.discard("")
+    return keys
+
+
+# Journal entries kept before consumers fall back to a full rebuild
+_JOURNAL_LIMIT = 50000
+
+# Identity of a class under a key: its USR, or the object without one
+_EntryKey = Union[str, int]
+
+
+def _entry_key(info: SymbolInfo) -> _EntryKey:
+    return info.usr or id(info)
+
+# What derived structures depend on: name, key, kind, scope, bases and parameters
+_Signature = Tuple[str, str, str, bool, Tuple[str, ...], Optional[str]]
+
+
+def _signature(info: SymbolInfo) -> _Signature:
+    return (
+        info.name,
+        info.qualified_name or info.name,
+        info.kind,
+        info.is_project,
+        tuple(info.base_classes),
+        info.template_parameters,
+    )
+
+
+class ClassChanges(NamedTuple):
+    """Net class changes over a span of journal entries."""
+
+    # Simple names of classes added, removed or changed
+    names: Set[str]
+    # Base keys (base names and their template arguments) of those classes,
+    # before and after the change
+    base_names: Set[str]
+
+
+class InheritanceIndex:
+    """Base class name -> class symbols deriving from it (see module docstring)."""
+
+    def __init__(self) -> None:
+        # Keyed per base key by USR (or object), so unlinking one class of a
+        # popular base does not rewrite the base's whole entry list
+        self._derived: Dict[str, Dict[_EntryKey, SymbolInfo]] = defaultdict(dict)
+        # Journal of (USR, signature before, signature after); entry i has
+        # version _journal_start + i + 1.  A clear or rebuild empties it.
+        self._journal: List[Tuple[str, Optional[_Signature], Optional[_Signature]]] = []
+        self._journal_start = 0
+
+    @property
+    def version(self) -> int:
+        """Counter advanced by every class linked or unlinked."""
+        return self._journal_start + len(self._journal)
+
+    def _record(self, usr: str, before: Optional[_Signature], after: Optional[_Signature]) -> None:
+        if len(self._journal) >= _JOURNAL_LIMIT:
+            dropped = _JOURNAL_LIMIT // 2
+            del self._journal[:dropped]
+            self._journal_start += dropped
+        self._journal.append((usr, before, after))
+
+    def _reset(self) -> None:
+        """Start a new journal; earlier versions can no longer be caught up."""
+        self._journal_start = self.version + 1
+        self._journal = []
+
+    def add(self, info: SymbolInfo) -> None:
+        """Link a class symbol under each of its base keys."""
+        self._record(info.usr, None, _signature(info))
+        entry = _entry_key(info)
+        for key in base_keys(info):
+            self._derived[key][entry] = info
+
+    def remove(self, info: SymbolInfo) -> None:
+        """Unlink a class symbol (matched by USR, or identity without one)."""
+        self._record(info.usr, _signature(info), None)
+        entry = _entry_key(info)
+        for key in base_keys(info):
+            entries = self._derived.get(key)
+            if entries is None or entries.pop(entry, None) is None:
+                continue
+            if not entries:
+                del self._derived[key]
+
+    def clear(self) -> None:
+        self._derived.clear()
+        self._reset()
+
+    def rebuild(self, class_infos: Iterable[SymbolInfo]) -> None:
+        """Rebuild the index from all class symbols."""
+        self._derived.clear()
+        for info in class_infos:
+            entry = _entry_key(info)
+            for key in base_keys(info):
+                self._derived[key][entry] = info
+        self._reset()
+
+    def changes_since(self, version: int) -> Optional[ClassChanges]:
+        """Net class changes after version, or None if they are no longer known.
+
+        Entries are diffed per USR: a class unlinked and linked again with the
+        same name, kind, scope, bases and template parameters (a re-indexed
+        file that did not touch it) is not a change.  Classes without a USR
+        always count as changed.
+        """
+        start = version - self._journal_start
+        if start < 0 or version > self.version:
+            return None
+        net: Dict[str, List[Optional[_Signature]]] = {}
+        changed: List[Optional[_Signature]] = []
+        for usr, before, after in self._journal[start:]:
+            if not usr:
+                changed.extend((before, after))
+            elif usr in net:
+                net[usr][1] = after
+            else:
+                net[usr] = [before, after]
+        for before, after in net.values():
+            if before != after:
+                changed.extend((before, after))
+
+        names: Set[str] = set()
+        base_names: Set[str] = set()
+        for sig in changed:
+            if sig is None:
+                continue
+            names.add(sig[0])
+            for base in sig[4]:
+                base_names.add(base_key(base))
+                base_names.update(base_key(arg) for arg in _top_level_template_args(base))
+        base_names.discard("")
+        return ClassChanges(names, base_names)
+
+    def candidates(self, name: str) -> List[SymbolInfo]:
+        """Class symbols that may derive from the class with this (simple) name."""
+        entries = self._derived.get(base_key(name))
+        return list(entries.values()) if entries else []
+
+    def key_count(self) -> int:
+        return len(self._derived)
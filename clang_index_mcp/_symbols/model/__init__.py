@@ -2,9 +2,12 @@
 
 from .symbol_info import (
     CLASS_KINDS,
+    FUNCTION_KINDS,
     SymbolInfo,
     get_template_param_base_indices,
     is_richer_definition,
+    short_type_name,
+    template_parameter_names,
 )
 from .symbol_views import (
     build_location_objects,
@@ -14,10 +17,13 @@ from .symbol_views import (
 
 __all__ = [
     "CLASS_KINDS",
+    "FUNCTION_KINDS",
     "SymbolInfo",
     "build_location_objects",
     "get_template_param_base_indices",
     "is_richer_definition",
     "omit_empty",
+    "short_type_name",
     "symbol_info_to_dict",
+    "template_parameter_names",
 ]
@@ -2,7 +2,8 @@
 
 import json
 from dataclasses import dataclass, field
-from typing import List, Optional
+from functools import lru_cache
+from typing import List, Optional, Tuple
 
 
 @dataclass(slots=True)
@@ -58,6 +59,9 @@ class SymbolInfo:
     is_pure_virtual: bool = False  # True if method is pure virtual (= 0)
     is_const: bool = False  # True if method is const-qualified
     is_static: bool = False  # True if method/function is static
+    # USRs of the base class methods this method overrides (direct overrides only).
+    # Persisted to the method_overrides table, not to symbols
+    overridden_usrs: List[str] = field(default_factory=list)
 
     # Definition tracking (exposed for LLM tools)
     is_definition: bool = False  # True if this cursor is a definition (has body)
@@ -65,6 +69,8 @@ class SymbolInfo:
 
 # Constants for class-like symbol kinds
 CLASS_KINDS = ("class", "struct", "class_template", "partial_specialization")
+# Constants for function-like symbol kinds
+FUNCTION_KINDS = ("function", "method", "function_template")
 
 
 def is_richer_definition(new_symbol: "SymbolInfo", existing_symbol: "SymbolInfo") -> bool:
@@ -101,6 +107,29 @@ def is_richer_definition(new_symbol: "SymbolInfo", existing_symbol: "SymbolInfo"
     return False
 
 
+@lru_cache(maxsize=8192)
+def _parse_template_parameter_names(template_parameters: str) -> Tuple[str, ...]:
+    try:
+        params = json.loads(template_parameters)
+    except (json.JSONDecodeError, TypeError):
+        return ()
+    if not isinstance(params, list):
+        return ()
+    return tuple(str(p.get("name") or "") if isinstance(p, dict) else "" for p in params)
+
+
+def template_parameter_names(template_parameters: Optional[str]) -> Tuple[str, ...]:
+    """Return the parameter names of a template_parameters JSON array, in order.
+
+    Unnamed parameters give "".  Parsed once per distinct JSON string: every
+    instantiation of a template shares its primary's string, so deferred base
+    resolution and hierarchy queries do not re-parse it per symbol.
+    """
+    if not template_parameters:
+        return ()
+    return _parse_template_parameter_names(template_parameters)
+
+
 def get_template_param_base_indices(info: "SymbolInfo") -> List[int]:
     """Return indices of base_classes entries that are template parameters.
 
@@ -117,13 +146,8 @@ def get_template_param_base_indices(info: "SymbolInfo") -> List[int]:
     if not info.template_parameters or not info.base_classes:
         return []
 
-    # Parse template parameter names
-    try:
-        params = json.loads(info.template_parameters)
-    except (json.JSONDecodeError, TypeError):
-        return []
-
-    param_names = {p.get("name", "") for p in params if p.get("name")}
+    param_names = set(template_parameter_names(info.template_parameters))
+    param_names.discard("")
     if not param_names:
         return []
 
@@ -134,3 +158,8 @@ def get_template_param_base_indices(info: "SymbolInfo") -> List[int]:
             indices.append(i)
 
     return indices
+
+
+def short_type_name(type_name: str) -> str:
+    """Unqualified name of a type spelling: "app::Box<int>" -> "Box"."""
+    return type_name.split("<", 1)[0].rsplit("::", 1)[-1].strip()
@@ -0,0 +1,270 @@
+"""Namespace tree over a name-keyed symbol index.
+
+A namespace filter matches a symbol whose namespace equals the filter or ends
+with "::" + filter (see symbol_filters.matches_namespace).  NamespaceTree
+stores the namespace components innermost-first in a trie, so every namespace
+ending with a given suffix lives in one subtree, and a namespace-filtered
+query collects that subtree instead of testing every symbol in the index.
+
+SymbolIndexStore keeps one tree for class_index and one for function_index
+and updates them wherever it adds or removes a symbol, like the inheritance
+index.  Each entry carries its position in index iteration order (the order
+its name first entered the index, then insertion order within the name), so
+results come out in the order a full scan would produce.
+
+Since a tree sees every symbol its index gains or loses, it also journals
+them, so structures derived from the whole index (signature postings, search
+shards, name lookups) can catch up from the symbols added since they were
+built (see changes_since) and sort their results with scan_order.
+"""
+
+from typing import Dict, Iterable, List, NamedTuple, Optional, Tuple, Union
+
+from .model import SymbolInfo
+
+# Identity of an entry within its trie node: the USR, or the object for
+# symbols without one
+_EntryKey = Union[str, int]
+_Order = Tuple[int, int]
+
+# Journal entries kept before consumers fall back to a full rebuild
+_JOURNAL_LIMIT = 50000
+
+
+def namespace_components(namespace: str) -> List[str]:
+    """Split a namespace into its components ("" is the global namespace)."""
+    return namespace.split("::") if namespace else []
+
+
+def _entry_key(info: SymbolInfo) -> _EntryKey:
+    return info.usr or id(info)
+
+
+class IndexChanges(NamedTuple):
+    """Symbols added to and removed from an index over a span of journal entries."""
+
+    added: List[SymbolInfo]
+    removed: List[SymbolInfo]
+
+
+class _Node:
+    __slots__ = ("children", "symbols")
+
+    def __init__(self) -> None:
+        self.children: Dict[str, "_Node"] = {}
+        # Symbols whose namespace ends exactly here, with their scan order
+        self.symbols: Dict[_EntryKey, List[Tuple[_Order, SymbolInfo]]] = {}
+
+
+class NamespaceTree:
+    """Suffix trie of namespaces, kept in step with a name-keyed index."""
+
+    def __init__(self, index: Optional[Dict[str, List[SymbolInfo]]] = None):
+        """
+        Args:
+            index: A name-keyed index (class_index or function_index) to load,
+                in its iteration order.
+        """
+        # Journal of (symbol, added); entry i has version _journal_start + i + 1.
+        # A clear or rebuild empties it.
+        self._journal: List[Tuple[SymbolInfo, bool]] = []
+        self._journal_start = 0
+        self.rebuild(index or {})
+
+    @property
+    def version(self) -> int:
+        """Counter advanced by every symbol added or removed."""
+        return self._journal_start + len(self._journal)
+
+    def _record(self, info: SymbolInfo, added: bool) -> None:
+        if len(self._journal) >= _JOURNAL_LIMIT:
+            dropped = _JOURNAL_LIMIT // 2
+            del self._journal[:dropped]
+            self._journal_start += dropped
+        self._journal.append((info, added))
+
+    def _reset(self) -> None:
+        """Start a new journal; earlier versions can no longer be caught up."""
+        self._journal_start = self.version + 1
+        self._journal = []
+
+    def rebuild(self, index: Dict[str, List[SymbolInfo]]) -> None:
+        """Reload the tree from a whole index, in its iteration order."""
+        self._clear_entries()
+        for infos in index.values():
+            for info in infos:
+                self._insert(info)
+        self._reset()
+
+    def clear(self) -> None:
+        self._clear_entries()
+        self._reset()
+
+    def _clear_entries(self) -> None:
+        self._root = _Node()
+        # namespace -> kind -> [all symbols, project symbols]
+        self._counts: Dict[str, Dict[str, List[int]]] = {}
+        # Symbol name -> (rank of the name in index order, symbols with the name)
+        self._names: Dict[str, List[int]] = {}
+        self._next_rank = 0
+        self._next_seq = 0
+
+    def add(self, info: SymbolInfo) -> None:
+        """Add a symbol appended to its name's list in the index."""
+        self._insert(info)
+        self._record(info, True)
+
+    def _insert(self, info: SymbolInfo) -> None:
+        name = self._names.get(info.name)
+        if name is None:
+            name = self._names[info.name] = [self._next_rank, 0]
+            self._next_rank += 1
+        name[1] += 1
+
+        node = self._root
+        for component in reversed(namespace_components(info.namespace)):
+            child = node.children.get(component)
+            if child is None:
+                child = node.children[component] = _Node()
+            node = child
+        node.symbols.setdefault(_entry_key(info), []).append(((name[0], self._next_seq), info))
+        self._next_seq += 1
+
+        counts = self._counts.setdefault(info.namespace, {}).setdefault(info.kind, [0, 0])
+        counts[0] += 1
+        if info.is_project:
+            counts[1] += 1
+
+    def remove(self, info: SymbolInfo) -> None:
+        """Remove a symbol the way the index does (by USR, or by equality without one)."""
+        path = [self._root]
+        for component in reversed(namespace_components(info.namespace)):
+            child = path[-1].children.get(component)
+            if child is None:
+                return
+            path.append(child)
+        node = path[-1]
+
+        if info.usr:
+            entries = node.symbols.get(info.usr, ())
+            removed = [entry for entry in entries if entry[1].name == info.name]
+            kept = [entry for entry in entries if entry[1].name != info.name]
+            if kept:
+                node.symbols[info.usr] = kept
+            elif removed:
+                del node.symbols[info.usr]
+        else:
+            removed = []
+            for key, entries in list(node.symbols.items()):
+                if isinstance(key, int) and entries[0][1] == info:
+                    removed.extend(entries)
+                    del node.symbols[key]
+        if not removed:
+            return
+
+        for _, symbol in removed:
+            self._uncount(symbol)
+            self._record(symbol, False)
+
+        # Drop trie nodes left without symbols
+        for depth in range(len(path) - 1, 0, -1):
+            if path[depth].symbols or path[depth].children:
+                break
+            parent = path[depth - 1]
+            for component, child in parent.children.items():
+                if child is path[depth]:
+                    del parent.children[component]
+                    break
+
+    def _node_of(self, namespace: str) -> Optional[_Node]:
+        node: Optional[_Node] = self._root
+        for component in reversed(namespace_components(namespace)):
+            node = node.children.get(component) if node is not None else None
+        return node
+
+    def _uncount(self, info: SymbolInfo) -> None:
+        name = self._names[info.name]
+        name[1] -= 1
+        if not name[1]:
+            # The index drops the emptied name; re-adding it appends it at the end
+            del self._names[info.name]
+
+        kinds = self._counts[info.namespace]
+        counts = kinds[info.kind]
+        counts[0] -= 1
+        if info.is_project:
+            counts[1] -= 1
+        if not counts[0]:
+            del kinds[info.kind]
+            if not kinds:
+                del self._counts[info.namespace]
+
+    def symbols_in(self, filter_namespace: str) -> List[SymbolInfo]:
+        """Return symbols matching a namespace filter, in index order.
+
+        An empty filter selects the global namespace only; otherwise the
+        filter matches the whole namespace or a "::"-aligned suffix of it.
+        """
+        node = self._node_of(filter_namespace)
+        if node is None:
+            return []
+
+        entries: List[Tuple[_Order, SymbolInfo]] = []
+        stack = [node]
+        while stack:
+            current = stack.pop()
+            for symbols in current.symbols.values():
+                entries.extend(symbols)
+            if filter_namespace != "":
+                stack.extend(current.children.values())
+        entries.sort(key=_order)
+        return [info for _, info in entries]
+
+    def namespace_counts(
+        self, project_only: bool = False, kinds: Optional[Iterable[str]] = None
+    ) -> Dict[str, int]:
+        """Return the number of symbols declared directly in each namespace.
+
+        Args:
+            project_only: Count project symbols only.
+            kinds: Count only symbols of these kinds (all kinds if None).
+        """
+        column = 1 if project_only else 0
+        wanted = None if kinds is None else set(kinds)
+        result: Dict[str, int] = {}
+        for namespace, by_kind in self._counts.items():
+            count = sum(
+                counts[column]
+                for kind, counts in by_kind.items()
+                if wanted is None or kind in wanted
+            )
+            if count:
+                result[namespace] = count
+        return result
+
+
+    def scan_order(self, info: SymbolInfo) -> Optional[_Order]:
+        """Return a sort key giving the symbol's place in index iteration order.
+
+        Returns None if this very symbol object is no longer in the index.
+        """
+        node = self._node_of(info.namespace)
+        if node is not None:
+            for order, symbol in node.symbols.get(_entry_key(info), ()):
+                if symbol is info:
+                    return order
+        return None
+
+    def changes_since(self, version: int) -> Optional[IndexChanges]:
+        """Symbols added and removed after version, or None if they are no longer known."""
+        start = version - self._journal_start
+        if start < 0 or version > self.version:
+            return None
+        changes = IndexChanges([], [])
+        for info, added in self._journal[start:]:
+            (changes.added if added else changes.removed).append(info)
+        return changes
+
+
+def _order(entry: Tuple[_Order, SymbolInfo]) -> _Order:
+    return entry[0]
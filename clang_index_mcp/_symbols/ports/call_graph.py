@@ -1,6 +1,6 @@
 """Call graph port used by the symbol store during indexing and maintenance."""
 
-from typing import List, Protocol
+from typing import Iterable, List, Protocol
 
 from ..._symbols.model import SymbolInfo
 from .parser import CallSiteRecord
@@ -13,6 +13,10 @@ class CallGraphPort(Protocol):
         """Remove all call sites involving the given USR."""
         ...
 
+    def remove_symbols(self, usrs: Iterable[str]) -> None:
+        """Remove all call sites involving any of the given USRs in one batch."""
+        ...
+
     def clear(self) -> None:
         """Clear transient in-memory call graph data."""
         ...
@@ -8,12 +8,14 @@ shared symbol store, call graph, and cache.
 
 import json
 import re
-from typing import TYPE_CHECKING, Any, Dict, List, Optional, Set
+import time
+from collections import defaultdict
+from typing import TYPE_CHECKING, Any, Dict, List, Optional, Set, Tuple
 
 from clang.cindex import TranslationUnit
 
 from .._core import diagnostics
-from .._symbols.model import SymbolInfo
+from .._symbols.model import CLASS_KINDS, SymbolInfo, template_parameter_names
 from .._symbols.ports.parser import SymbolParser
 from .._compilation.template_resolver import TemplateResolver
 
@@ -77,24 +79,13 @@ class SymbolExtractor:
         return self.cache_orchestrator.get_file_hash(file_path)
 
     def _find_primary_template_info(self, primary_template_usr: str) -> Optional[Any]:
-        """Look up the primary template in class_index by USR."""
+        """Look up the primary template class by USR."""
         with self.symbol_store.index_lock:
-            for name, infos in self.class_index.items():
-                for info in infos:
-                    if info.usr == primary_template_usr:
-                        return info
+            info = self.usr_index.get(primary_template_usr)
+        if info is not None and info.kind in CLASS_KINDS:
+            return info
         return None
 
-    def _parse_template_params(self, primary_info: Any) -> List[dict]:
-        """Parse template_parameters JSON from a primary template info."""
-        if not primary_info.template_parameters:
-            return []
-        try:
-            result: List[Dict[str, Any]] = json.loads(primary_info.template_parameters)
-            return result
-        except (json.JSONDecodeError, TypeError):
-            return []
-
     def _parse_json_field(self, field_value: Optional[str]) -> Any:
         """Safely parse a JSON field, returning None on failure."""
         if not field_value:
@@ -104,31 +95,24 @@ class SymbolExtractor:
         except (json.JSONDecodeError, TypeError):
             return None
 
-    def _process_deferred_instantiation(self, info: SymbolInfo) -> bool:
-        """Process a single deferred instantiation and return True if resolved."""
-        if not info.template_arguments or not info.primary_template_usr or info.base_classes:
-            return False
-
+    def _process_deferred_instantiation(
+        self, info: SymbolInfo, primary_info: SymbolInfo, param_names: Tuple[str, ...]
+    ) -> bool:
+        """Resolve one deferred instantiation of primary_info; return True if resolved."""
         template_args = self._parse_json_field(info.template_arguments)
         if not template_args:
             return False
 
-        primary_info = self.usr_index.get(info.primary_template_usr)
-        if not primary_info:
-            return False
-
-        template_params = self._parse_json_field(primary_info.template_parameters)
-        if not template_params:
-            return False
-
-        param_to_arg = TemplateResolver.build_param_mapping(template_params, template_args)
+        param_to_arg = TemplateResolver.build_param_mapping_from_names(
+            param_names, template_args
+        )
 
         resolved = TemplateResolver.substitute_in_bases(
             primary_info.base_classes, param_to_arg, template_args
         )
 
         if resolved:
-            info.base_classes = resolved
+            self.symbol_store.set_base_classes(info, resolved)
             info.template_arguments = None
             diagnostics.debug(f"Deferred resolution: {info.qualified_name} -> bases={resolved}")
             return True
@@ -136,16 +120,37 @@ class SymbolExtractor:
 
     def resolve_deferred_instantiation_bases(self) -> int:
         """Resolve base_classes for template instantiations that couldn't be resolved during parsing."""
+        start_time = time.perf_counter()
+        # Pending instantiations grouped by primary template, so each primary is
+        # looked up and its parameter names read once per batch
+        pending: Dict[str, List[SymbolInfo]] = defaultdict(list)
+        for info in self.symbol_store.iter_template_specializations():
+            if info.kind in CLASS_KINDS and info.template_arguments and not info.base_classes:
+                pending[info.primary_template_usr].append(info)  # type: ignore[index]
+        if not pending:
+            return 0
+
         resolved_count = 0
-        for name, infos in self.class_index.items():
+        pending_count = 0
+        for primary_usr, infos in pending.items():
+            pending_count += len(infos)
+            primary_info = self.usr_index.get(primary_usr)
+            if not primary_info or not primary_info.base_classes:
+                continue
+            param_names = template_parameter_names(primary_info.template_parameters)
+            if not param_names:
+                continue
             for info in infos:
-                if self._process_deferred_instantiation(info):
+                if self._process_deferred_instantiation(info, primary_info, param_names):
                     resolved_count += 1
 
         if resolved_count > 0:
-            diagnostics.info(
-                f"Resolved base_classes for {resolved_count} template instantiation(s)"
-            )
+            self.symbol_store.bump_generation()
+        diagnostics.info(
+            f"Resolved base_classes for {resolved_count}/{pending_count} template "
+            f"instantiation(s) of {len(pending)} template(s) "
+            f"in {time.perf_counter() - start_time:.2f}s"
+        )
         return resolved_count
 
     def _extract_template_base_name_from_usr(self, usr: str) -> Optional[str]:
@@ -7,7 +7,8 @@ and index maintenance operations.
 
 import dataclasses
 from collections import defaultdict
-from typing import TYPE_CHECKING, Any, Dict, List, Optional
+from contextlib import contextmanager
+from typing import TYPE_CHECKING, Any, Dict, Iterable, Iterator, List, Optional, Set, Tuple
 
 if TYPE_CHECKING:
     from .._persistence.cache_manager import CacheManager
@@ -15,6 +16,10 @@ if TYPE_CHECKING:
 from .._core import diagnostics
 from .._symbols.model import CLASS_KINDS, SymbolInfo, is_richer_definition
 from .._symbols import symbol_resolver, template_symbol_indexer
+from .._symbols.file_change_log import FileChangeLog
+from .._symbols.inheritance_index import ClassChanges, InheritanceIndex
+from .._symbols.template_symbol_indexer import SpecializationRegistry
+from .._symbols.namespace_tree import NamespaceTree
 from .._symbols.ports.alias_persistence import AliasPersistence
 from .._symbols.ports.call_graph import CallGraphPort
 from .._symbols.ports.lock_provider import LockProvider
@@ -54,13 +59,52 @@ class SymbolIndexStore:
         self.function_index: Dict[str, List[SymbolInfo]] = defaultdict(list)
         self.file_index: Dict[str, List[SymbolInfo]] = defaultdict(list)
         self.usr_index: Dict[str, SymbolInfo] = {}
+        # Base class name -> classes deriving from it, kept in step with class_index
+        self.inheritance_index = InheritanceIndex()
+        # Namespace tries over class_index / function_index, kept in step with them
+        self.class_namespaces = NamespaceTree()
+        self.function_namespaces = NamespaceTree()
+        # Primary template USR -> specializations, kept in step with usr_index
+        self.specializations = SpecializationRegistry()
+        # Files whose symbols changed, for structures derived from a few files
+        self.file_changes = FileChangeLog()
 
         # Track indexed files and hashes
         self.file_hashes: Dict[str, str] = {}
         self._indexed_file_count = 0
 
+        # Bumped on every index mutation so derived structures (search shards,
+        # result caches) can tell whether they are stale.
+        self.generation = 0
+        # USRs whose call sites are removed when the current merge finishes
+        # (None outside _batched_call_graph_removals)
+        self._pending_call_graph_removals: Optional[List[str]] = None
+
+    def bump_generation(self) -> None:
+        """Mark the indexes as changed (for mutations made outside this class)."""
+        self.generation += 1
+
+    @contextmanager
+    def _batched_call_graph_removals(self) -> Iterator[None]:
+        """Collect the call graph removals of a merge and apply them as one batch on exit.
+
+        Nested uses join the outermost batch.
+        """
+        if self._pending_call_graph_removals is not None:
+            yield
+            return
+        self._pending_call_graph_removals = []
+        try:
+            yield
+        finally:
+            usrs, self._pending_call_graph_removals = self._pending_call_graph_removals, None
+            if usrs:
+                self.call_graph_port.remove_symbols(usrs)
+
     def _remove_symbol_from_indexes(self, symbol: SymbolInfo) -> None:
         """Remove a single symbol from class/function/USR indexes and call graph."""
+        self.generation += 1
+        self.file_changes.record(symbol.file)
         # 1. Global name-based indexes
         target_index = (
             self.class_index
@@ -80,6 +124,12 @@ class SymbolIndexStore:
             if not target_index[symbol.name]:
                 del target_index[symbol.name]
 
+        if target_index is self.class_index:
+            self.class_namespaces.remove(symbol)
+            self.inheritance_index.remove(symbol)
+        else:
+            self.function_namespaces.remove(symbol)
+
         # 2. USR and Call Graph
         if symbol.usr:
             if symbol.usr in self.usr_index:
@@ -87,7 +137,11 @@ class SymbolIndexStore:
                 existing = self.usr_index[symbol.usr]
                 if existing == symbol or existing.usr == symbol.usr:
                     del self.usr_index[symbol.usr]
-            self.call_graph_port.remove_symbol(symbol.usr)
+                    self.specializations.remove(existing)
+            if self._pending_call_graph_removals is not None:
+                self._pending_call_graph_removals.append(symbol.usr)
+            else:
+                self.call_graph_port.remove_symbol(symbol.usr)
 
     def _handle_symbol_definition_wins(
         self, info: SymbolInfo, existing_symbol: SymbolInfo
@@ -171,8 +225,10 @@ class SymbolIndexStore:
 
         # Apply all updates with a single lock acquisition
         with self._lock_provider:
+            self.generation += 1
             # Clear old entries for this file
             self.clear_file_index_entries(file_path)
+            self.file_changes.record(file_path)
 
             # Add cached symbols
             self.file_index[file_path] = cached_symbols
@@ -180,9 +236,16 @@ class SymbolIndexStore:
             # Apply class/function/USR updates
             for name, symbols in class_updates.items():
                 self.class_index[name].extend(symbols)
+                for symbol in symbols:
+                    self.class_namespaces.add(symbol)
+                    self.inheritance_index.add(symbol)
             for name, symbols in function_updates.items():
                 self.function_index[name].extend(symbols)
+                for symbol in symbols:
+                    self.function_namespaces.add(symbol)
             self.usr_index.update(usr_updates)
+            for symbol in usr_updates.values():
+                self.specializations.add(symbol)
 
             self.file_hashes[file_path] = current_hash
 
@@ -213,8 +276,19 @@ class SymbolIndexStore:
 
         self.file_index[symbol.file].append(symbol)
 
+    def merge_file_symbols(self, file_path: str, symbols: List[SymbolInfo]) -> None:
+        """Replace a file's index entries with symbols (atomicity handled by caller).
+
+        Call sites of removed and replaced symbols are deleted in one batch.
+        """
+        with self._batched_call_graph_removals():
+            self.clear_file_index_entries(file_path)
+            for symbol in symbols:
+                self.merge_symbol_into_indexes(symbol)
+
     def merge_symbol_into_indexes(self, symbol: SymbolInfo):
         """Merge a single symbol into the main process indexes with deduplication."""
+        self.generation += 1
         if symbol.usr and symbol.usr in self.usr_index:
             existing = self.usr_index[symbol.usr]
             if symbol.is_definition and not existing.is_definition:
@@ -227,28 +301,40 @@ class SymbolIndexStore:
             else:
                 return
 
+        self.file_changes.record(symbol.file)
         if symbol.kind in CLASS_KINDS:
             self.class_index[symbol.name].append(symbol)
+            self.class_namespaces.add(symbol)
+            self.inheritance_index.add(symbol)
         else:
             self.function_index[symbol.name].append(symbol)
+            self.function_namespaces.add(symbol)
 
         if symbol.usr:
             self.usr_index[symbol.usr] = symbol
+            self.specializations.add(symbol)
 
         if symbol.file:
             self._add_to_file_index(symbol)
 
     def populate_indexes_from_cache(self, cache_data: Dict[str, Any]) -> None:
         """Populate main and file indexes from cache data."""
+        self.generation += 1
         # Load indexes - Memory optimization: SymbolInfo objects come directly
         # from SQLite backend (no dict conversion needed, saves ~500 MB peak)
         self.class_index.clear()
         for name, infos in cache_data.get("class_index", {}).items():
             self.class_index[name] = infos
+        self.inheritance_index.rebuild(
+            info for infos in self.class_index.values() for info in infos
+        )
+        self.class_namespaces.rebuild(self.class_index)
+        self.file_changes.reset()
 
         self.function_index.clear()
         for name, infos in cache_data.get("function_index", {}).items():
             self.function_index[name] = infos
+        self.function_namespaces.rebuild(self.function_index)
 
         # Rebuild file index mapping from loaded symbols
         self.file_index.clear()
@@ -266,6 +352,8 @@ class SymbolIndexStore:
 
     def rebuild_auxiliary_structures(self) -> None:
         """Rebuild USR index and call graph from loaded symbols."""
+        self.generation += 1
+        self.file_changes.reset()
         self.usr_index.clear()
         self.call_graph_port.clear()
 
@@ -283,6 +371,8 @@ class SymbolIndexStore:
                     self.usr_index[symbol.usr] = symbol
                     all_symbols.append(symbol)
 
+        self.specializations.rebuild(all_symbols)
+
         # Rebuild call graph from all symbols
         self.call_graph_port.rebuild_from_symbols(all_symbols)
 
@@ -310,30 +400,41 @@ class SymbolIndexStore:
             return 0
 
         added_count = 0
+        changed_files: Set[str] = set()
 
         # Single lock acquisition for all updates
         with self._lock_provider:
-            # Add all collected symbols
-            for info in symbols:
-                # USR-based deduplication with definition-wins logic
-                if info.usr and info.usr in self.usr_index:
-                    existing_symbol = self.usr_index[info.usr]
-                    resolved_info = self._handle_symbol_definition_wins(info, existing_symbol)
-                    if resolved_info is None:
-                        continue
-                    info = resolved_info
-
-                # New symbol or replacement - add to all indexes
-                if info.kind in CLASS_KINDS:
-                    self.class_index[info.name].append(info)
-                else:
-                    self.function_index[info.name].append(info)
-
-                if info.usr:
-                    self.usr_index[info.usr] = info
-
-                self._add_symbol_to_file_index(info)
-                added_count += 1
+            self.generation += 1
+            # Add all collected symbols; call sites of replaced symbols are
+            # removed in one batch before the new call sites are added
+            with self._batched_call_graph_removals():
+                for info in symbols:
+                    # USR-based deduplication with definition-wins logic
+                    if info.usr and info.usr in self.usr_index:
+                        existing_symbol = self.usr_index[info.usr]
+                        resolved_info = self._handle_symbol_definition_wins(info, existing_symbol)
+                        if resolved_info is None:
+                            continue
+                        info = resolved_info
+
+                    # New symbol or replacement - add to all indexes
+                    if info.kind in CLASS_KINDS:
+                        self.class_index[info.name].append(info)
+                        self.class_namespaces.add(info)
+                        self.inheritance_index.add(info)
+                    else:
+                        self.function_index[info.name].append(info)
+                        self.function_namespaces.add(info)
+
+                    if info.usr:
+                        self.usr_index[info.usr] = info
+                        self.specializations.add(info)
+
+                    self._add_symbol_to_file_index(info)
+                    changed_files.add(info.file)
+                    added_count += 1
+            for file_path in changed_files:
+                self.file_changes.record(file_path)
 
             # Add all collected call relationships
             self.call_graph_port.process_call_buffer(calls)
@@ -403,14 +504,20 @@ class SymbolIndexStore:
         Returns the list of symbols that were in file_index (used by workers
         to persist their results before clearing).
         """
+        self.generation += 1
         symbols = list(self.file_index.values())
         flat: List[SymbolInfo] = []
         for batch in symbols:
             flat.extend(batch)
         self.file_index.clear()
         self.class_index.clear()
+        self.inheritance_index.clear()
+        self.class_namespaces.clear()
+        self.file_changes.reset()
         self.function_index.clear()
+        self.function_namespaces.clear()
         self.usr_index.clear()
+        self.specializations.clear()
         self.file_hashes.clear()
         return flat
 
@@ -431,6 +538,15 @@ class SymbolIndexStore:
         with self._lock_provider:
             self._remove_symbol_from_indexes(symbol)
 
+    def set_base_classes(self, symbol: SymbolInfo, base_classes: List[str]) -> None:
+        """Replace the base classes of an indexed class, keeping the reverse index in step."""
+        with self._lock_provider:
+            self.generation += 1
+            self.file_changes.record(symbol.file)
+            self.inheritance_index.remove(symbol)
+            symbol.base_classes = base_classes
+            self.inheritance_index.add(symbol)
+
     # ------------------------------------------------------------------
     # Read accessors
     # ------------------------------------------------------------------
@@ -459,6 +575,43 @@ class SymbolIndexStore:
         """Iterate over (name, symbols) pairs in the class index."""
         return symbol_resolver.iter_class_items(self)
 
+    def get_derived_class_candidates(self, name: str) -> List[SymbolInfo]:
+        """Return the classes that may derive from the named class.
+
+        Candidates name the class (or one of its specializations) as a direct
+        base, or pass it as an argument of a templated base; callers check the
+        actual relation.
+        """
+        return self.inheritance_index.candidates(name)
+
+    def class_change_version(self) -> int:
+        """Version of the class graph, advanced by every class added or removed."""
+        return self.inheritance_index.version
+
+    def get_class_changes_since(self, version: int) -> Optional[ClassChanges]:
+        """Classes added, removed or changed since class_change_version() was version.
+
+        Returns None when the changes are no longer known (the indexes were
+        cleared or reloaded, or too much changed); callers then rebuild.
+        """
+        return self.inheritance_index.changes_since(version)
+
+    def file_change_version(self) -> int:
+        """Version of the file journal, advanced by every file whose symbols change."""
+        return self.file_changes.version
+
+    def get_files_changed_since(self, version: int) -> Optional[Set[str]]:
+        """Files whose symbols changed since file_change_version() was version.
+
+        Returns None when the changes are no longer known (the indexes were
+        cleared or reloaded, or too much changed); callers then start over.
+        """
+        return self.file_changes.changed_since(version)
+
+    def iter_template_specializations(self) -> List[SymbolInfo]:
+        """Return every in-memory symbol that specializes or instantiates a template."""
+        return list(self.specializations)
+
     def iter_function_items(self):
         """Iterate over (name, symbols) pairs in the function index."""
         return symbol_resolver.iter_function_items(self)
@@ -487,6 +640,23 @@ class SymbolIndexStore:
         """Return total number of function symbols (including duplicates by name)."""
         return symbol_resolver.total_function_symbols(self)
 
+    def get_namespace_trees(self) -> Tuple[NamespaceTree, NamespaceTree]:
+        """Return the (class, function) namespace trees (read them under index_lock)."""
+        return self.class_namespaces, self.function_namespaces
+
+    def list_namespaces(self, project_only: bool = True, parent: str = "") -> List[Dict[str, Any]]:
+        """Return namespaces with their class and function counts.
+
+        Counts are for symbols declared directly in the namespace;
+        ``total_symbols`` also includes all nested namespaces.
+
+        Args:
+            project_only: Count only project symbols (namespaces without any
+                project symbol are omitted).
+            parent: Only list this namespace and namespaces nested in it.
+        """
+        return symbol_resolver.list_namespaces(self, project_only, parent)
+
     def get_symbol_by_usr(self, usr: str) -> Optional[SymbolInfo]:
         """
         Resolve a USR to a SymbolInfo.
@@ -496,6 +666,15 @@ class SymbolIndexStore:
         """
         return symbol_resolver.get_symbol_by_usr(self, usr)
 
+    def get_symbols_by_usrs(self, usrs: Iterable[str]) -> Dict[str, SymbolInfo]:
+        """
+        Resolve several USRs to SymbolInfo at once, keyed by USR.
+
+        Symbols not in the in-memory index are loaded from SQLite in one
+        batched query.  Unresolvable USRs are left out.
+        """
+        return symbol_resolver.get_symbols_by_usrs(self, usrs)
+
     def resolve_symbol_info(self, usr: str) -> Optional[Dict[str, Any]]:
         """
         Return a rich symbol dict for a USR, using the backend fallback if needed.
@@ -506,13 +685,16 @@ class SymbolIndexStore:
 
     def _remove_file_from_indexes(self, file_path: str):
         """Remove all symbols from a deleted file from all indexes"""
+        self.generation += 1
+        self.file_changes.record(file_path)
         # Get all symbols that were in this file
         symbols_to_remove = self.file_index.get(file_path, []).copy()
         if symbols_to_remove:
             diagnostics.debug(f"Removing {len(symbols_to_remove)} symbols for file {file_path}")
 
-        for symbol in symbols_to_remove:
-            self._remove_symbol_from_indexes(symbol)
+        with self._batched_call_graph_removals():
+            for symbol in symbols_to_remove:
+                self._remove_symbol_from_indexes(symbol)
 
         # Finally remove from file_index
         if file_path in self.file_index:
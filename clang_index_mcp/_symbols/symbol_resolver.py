@@ -4,10 +4,10 @@ Isolates lookup/accessor methods so SymbolIndexStore can focus on index
 management.
 """
 
-from typing import TYPE_CHECKING, Any, Dict, List, Optional
+from typing import TYPE_CHECKING, Any, Dict, Iterable, List, Optional
 
 from .._core import diagnostics
-from .._symbols.model import build_location_objects, omit_empty
+from .._symbols.model import FUNCTION_KINDS, build_location_objects, omit_empty
 
 if TYPE_CHECKING:
     from .._symbols.model import SymbolInfo
@@ -113,6 +113,30 @@ def get_symbol_by_usr(store: "SymbolIndexStore", usr: str) -> Optional["SymbolIn
     return None
 
 
+def get_symbols_by_usrs(store: "SymbolIndexStore", usrs: Iterable[str]) -> Dict[str, "SymbolInfo"]:
+    """
+    Resolve several USRs to SymbolInfo at once, keyed by USR.
+
+    In-memory hits are taken from the USR index; the rest are loaded from the
+    SQLite backend in one batched query.  Unresolvable USRs are left out.
+    """
+    found: Dict[str, "SymbolInfo"] = {}
+    missing: List[str] = []
+    for usr in usrs:
+        info = store.usr_index.get(usr)
+        if info is not None:
+            found[usr] = info
+        else:
+            missing.append(usr)
+    backend = store._cache_manager.backend
+    if missing and backend is not None:
+        try:
+            found.update(backend.load_symbols_by_usrs(sorted(set(missing))))
+        except Exception as e:
+            diagnostics.warning(f"Failed to load {len(missing)} symbols by USR: {e}")
+    return found
+
+
 def resolve_symbol_info(store: "SymbolIndexStore", usr: str) -> Optional[Dict[str, Any]]:
     """
     Return a rich symbol dict for a USR, using the backend fallback if needed.
@@ -134,3 +158,36 @@ def resolve_symbol_info(store: "SymbolIndexStore", usr: str) -> Optional[Dict[st
             **build_location_objects(info),
         }
     )
+
+
+def list_namespaces(
+    store: "SymbolIndexStore", project_only: bool, parent: str
+) -> List[Dict[str, Any]]:
+    """Return namespaces with direct and nested symbol counts from the namespace trees."""
+    with store.index_lock:
+        class_tree, function_tree = store.get_namespace_trees()
+        class_counts = class_tree.namespace_counts(project_only)
+        # function_index also holds variables, enums, typedefs, ...
+        function_counts = function_tree.namespace_counts(project_only, FUNCTION_KINDS)
+
+    totals: Dict[str, int] = {}
+    for counts in (class_counts, function_counts):
+        for namespace, count in counts.items():
+            # Credit the namespace and every enclosing namespace
+            prefix = namespace
+            while True:
+                totals[prefix] = totals.get(prefix, 0) + count
+                if not prefix:
+                    break
+                prefix = prefix.rpartition("::")[0]
+
+    return [
+        {
+            "namespace": namespace,
+            "classes": class_counts.get(namespace, 0),
+            "functions": function_counts.get(namespace, 0),
+            "total_symbols": total,
+        }
+        for namespace, total in sorted(totals.items())
+        if not parent or namespace == parent or namespace.startswith(parent + "::")
+    ]
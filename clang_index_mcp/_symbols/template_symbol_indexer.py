@@ -1,7 +1,8 @@
 """Template specialization lookup helpers for SymbolIndexStore."""
 
 import re
-from typing import TYPE_CHECKING, List, Optional
+from collections import defaultdict
+from typing import TYPE_CHECKING, Dict, Iterable, Iterator, List, Optional
 
 if TYPE_CHECKING:
     from .._symbols.model import SymbolInfo
@@ -82,3 +83,41 @@ def find_template_specializations(store: "SymbolIndexStore", base_name: str) ->
         add_function_template_symbols(store.function_index, base_name, results)
 
     return results
+
+
+class SpecializationRegistry:
+    """Primary template USR -> its specializations and instantiations, by USR.
+
+    Kept in step with the USR index, so deferred base resolution walks only
+    the specializations instead of scanning the class index.  Each entry is
+    the symbol itself, carrying its kind and template_arguments.
+    """
+
+    def __init__(self) -> None:
+        self._by_primary: Dict[str, Dict[str, "SymbolInfo"]] = defaultdict(dict)
+
+    def add(self, info: "SymbolInfo") -> None:
+        if info.primary_template_usr and info.usr:
+            self._by_primary[info.primary_template_usr][info.usr] = info
+
+    def remove(self, info: "SymbolInfo") -> None:
+        if not info.primary_template_usr or not info.usr:
+            return
+        entries = self._by_primary.get(info.primary_template_usr)
+        if entries is not None:
+            entries.pop(info.usr, None)
+            if not entries:
+                del self._by_primary[info.primary_template_usr]
+
+    def clear(self) -> None:
+        self._by_primary.clear()
+
+    def rebuild(self, symbols: Iterable["SymbolInfo"]) -> None:
+        self._by_primary.clear()
+        for info in symbols:
+            self.add(info)
+
+    def __iter__(self) -> Iterator["SymbolInfo"]:
+        """Iterate over all registered specializations."""
+        for entries in self._by_primary.values():
+            yield from entries.values()
@@ -29,7 +29,10 @@ from ._persistence.repositories.dependency_repository import SqliteDependencyRep
 from ._persistence.sqlite_cache_backend import SqliteCacheBackend
 from ._search.call_graph_service import CallGraphService
 from ._search.dependency_graph import DependencyGraphBuilder
+from ._search.parallel_search import ParallelFunctionSearch
+from ._search.query_cache import QueryResultCache
 from ._search.query_engine import QueryEngine
+from ._search.smart_fallback import SmartFallback
 from ._symbols.symbol_extractor import SymbolExtractor
 from ._symbols.symbol_index_store import SymbolIndexStore
 from ._symbols.ports.parser import TypeAliasRecord
@@ -103,7 +106,12 @@ class CompositionRoot:
         # Wire services in dependency order
 
         # 1. CallGraphService (needs cache_manager for call site storage)
-        self.call_graph_service = CallGraphService(self.cache_manager)
+        self.call_graph_service = CallGraphService(
+            self.cache_manager,
+            max_call_paths=self.config.get_call_path_max_paths(),
+            path_node_budget=self.config.get_call_path_node_budget(),
+            path_timeout_ms=self.config.get_call_path_timeout_ms(),
+        )
         self.context.symbols.call_graph_service = self.call_graph_service
 
         # 2. SymbolIndexStore (needs lock provider and call graph)
@@ -124,6 +132,13 @@ class CompositionRoot:
         self.context.compilation.compilation_env = self.compilation_env
 
         # 4. QueryEngine (needs symbol_store, cache, concurrency, compilation, call_graph)
+        self.parallel_search = ParallelFunctionSearch(
+            workers=self.config.get_search_workers(),
+            min_candidates=self.config.get_parallel_search_min_candidates(),
+        )
+        self.query_cache = QueryResultCache(
+            max_bytes=int(self.config.get_query_cache_max_mb() * 1024 * 1024)
+        )
         self.query_engine = QueryEngine(
             symbol_store=self.symbol_store,
             cache_manager=self.cache_manager,
@@ -131,11 +146,19 @@ class CompositionRoot:
             compilation_env=self.compilation_env,
             call_graph_service=self.call_graph_service,
             project_root=self.project_root,
+            smart_fallback=SmartFallback(
+                time_budget_ms=self.config.get_fallback_time_budget_ms()
+            ),
+            parallel_search=self.parallel_search,
+            query_cache=self.query_cache,
         )
         self.context.query.query_engine = self.query_engine
+        self.context.query.query_cache = self.query_cache
 
         # Break circular dependency: CallGraphService needs symbol_store/query_engine
-        self.call_graph_service.set_dependencies(self.symbol_store, self.query_engine)
+        self.call_graph_service.set_dependencies(
+            self.symbol_store, self.query_engine, self.query_cache
+        )
 
         # 5. CacheOrchestrator
         self.cache_orchestrator = CacheOrchestrator(
@@ -120,6 +120,8 @@ class CppAnalyzer:
                 and self._root.worker_result_merger is not None
             ):
                 self._root.worker_result_merger.close()
+            if getattr(self._root, "parallel_search", None) is not None:
+                self._root.parallel_search.close()
         if hasattr(self, "cache_manager") and self.cache_manager is not None:
             self.cache_manager.close()
 
@@ -259,6 +261,10 @@ class CppAnalyzer:
         """Get detailed information about a specific class (delegates to query_engine)."""
         return self._root.query_engine.get_class_info(class_name)
 
+    def get_class_info_batch(self, class_names: List[str]) -> Dict[str, Any]:
+        """Class info for several classes in one request, with per-class errors."""
+        return self._root.query_engine.get_class_info_batch(class_names)
+
     def get_function_signature(
         self, function_name: str, class_name: Optional[str] = None
     ) -> List[str]:
@@ -269,6 +275,10 @@ class CppAnalyzer:
         """Get comprehensive type alias information (delegates to query_engine)."""
         return self._root.query_engine.get_type_alias_info(type_name)
 
+    def list_namespaces(self, project_only: bool = True, parent: str = "") -> Dict[str, Any]:
+        """List namespaces with symbol counts (delegates to query_engine)."""
+        return self._root.query_engine.list_namespaces(project_only, parent)
+
     def search_symbols(
         self,
         pattern: str,
@@ -313,16 +323,31 @@ class CppAnalyzer:
             class_name, max_nodes, max_depth, direction
         )
 
+    def get_class_hierarchy_stats(
+        self, limit: int = 10, project_only: bool = True
+    ) -> Dict[str, Any]:
+        """Inheritance depth, fan-out and the widest base classes of the project."""
+        return self._root.query_engine.get_class_hierarchy_stats(limit, project_only)
+
     def find_incoming_calls(
         self,
         function_name: str,
         class_name: str = "",
         include_call_sites: bool = True,
         project_only: bool = True,
+        include_virtual_dispatch: bool = False,
+        page_size: Optional[int] = None,
+        cursor: Optional[str] = None,
     ) -> Dict[str, Any]:
         """Find all functions that call the specified function."""
         return self._root.call_graph_service.find_incoming_calls(
-            function_name, class_name, include_call_sites, project_only
+            function_name,
+            class_name,
+            include_call_sites,
+            project_only,
+            include_virtual_dispatch,
+            page_size,
+            cursor,
         )
 
     def find_callees(
@@ -331,6 +356,46 @@ class CppAnalyzer:
         """Find all functions called by the specified function."""
         return self._root.call_graph_service.find_callees(function_name, class_name, project_only)
 
+    def find_transitive_callers(
+        self,
+        function_name: str,
+        class_name: str = "",
+        max_depth: int = 3,
+        max_nodes: int = 500,
+        project_only: bool = True,
+    ) -> Dict[str, Any]:
+        """Find all functions reaching the specified function within max_depth calls."""
+        return self._root.call_graph_service.find_transitive_callers(
+            function_name, class_name, max_depth, max_nodes, project_only
+        )
+
+    def find_transitive_callees(
+        self,
+        function_name: str,
+        class_name: str = "",
+        max_depth: int = 3,
+        max_nodes: int = 500,
+        project_only: bool = True,
+    ) -> Dict[str, Any]:
+        """Find all functions reachable from the specified function within max_depth calls."""
+        return self._root.call_graph_service.find_transitive_callees(
+            function_name, class_name, max_depth, max_nodes, project_only
+        )
+
+    def get_call_hotspots(self, limit: int = 10, project_only: bool = True) -> Dict[str, Any]:
+        """Most called functions, fan-out outliers and uncalled functions of the project."""
+        return self._root.call_graph_service.get_call_hotspots(limit, project_only)
+
+    def find_overrides(
+        self, function_name: str, class_name: str = "", project_only: bool = True
+    ) -> Dict[str, Any]:
+        """Every override of a virtual method across the class hierarchy."""
+        return self._root.call_graph_service.find_overrides(function_name, class_name, project_only)
+
+    def find_template_call_sites(self, type_name: str, function_name: str = "") -> Dict[str, Any]:
+        """Calls to external templates instantiated with a project type."""
+        return self._root.call_graph_service.find_template_call_sites(type_name, function_name)
+
     def get_call_sites(self, function_name: str, class_name: str = "") -> List[Dict[str, Any]]:
         """Get all call sites FROM a specific function."""
         return self._root.call_graph_service.get_call_sites(function_name, class_name)
@@ -338,7 +403,7 @@ class CppAnalyzer:
     def get_call_path(
         self, from_function: str, to_function: str, max_depth: int = 10
     ) -> List[List[str]]:
-        """Find call paths from one function to another using BFS."""
+        """Find the shortest call paths from one function to another."""
         return self._root.call_graph_service.get_call_path(from_function, to_function, max_depth)
 
     def find_in_file(self, file_path: str, pattern: str) -> Dict[str, Any]:
@@ -83,6 +83,13 @@ class CppAnalyzerConfig:
         "max_parse_retries": 2,  # Maximum number of times to retry parsing a failed file
         "max_workers": None,  # None = use cpu_count(), or specify integer for memory control
         "query_behavior": "allow_partial",  # allow_partial, block, or reject
+        "search_workers": 1,  # >1 = shard function search across N workers, 0 = cpu_count()
+        "parallel_search_min_candidates": 200000,  # smaller indexes are scanned serially
+        "query_cache_max_mb": 64,  # size bound of the query result cache, 0 = disabled
+        "fallback_time_budget_ms": 50,  # time budget of one empty-result suggestion analysis
+        "call_path_max_paths": 10,  # shortest paths returned by trace_execution_path
+        "call_path_node_budget": 200000,  # functions one call path query may expand
+        "call_path_timeout_ms": 5000,  # wall-clock limit of one call path query
         "diagnostics": {"level": "info", "enabled": True},  # debug, info, warning, error, fatal
     }
 
@@ -180,6 +187,80 @@ class CppAnalyzerConfig:
         diagnostics.warning(f"Invalid max_workers value: {value}. Using default (cpu_count).")
         return None
 
+    def get_search_workers(self) -> int:
+        """Get number of workers used to verify function search candidates.
+
+        Returns:
+            1 (default) for a serial scan, or the number of name-hash shards
+            searched in parallel. A configured 0 means cpu_count().
+        """
+        value = self.config.get("search_workers", self.DEFAULT_CONFIG["search_workers"])
+        if value == 0:
+            return os.cpu_count() or 1
+        if isinstance(value, int) and not isinstance(value, bool) and value > 0:
+            return value
+        diagnostics.warning(f"Invalid search_workers value: {value}. Using default (1).")
+        return 1
+
+    def get_parallel_search_min_candidates(self) -> int:
+        """Get the function count below which search stays serial."""
+        value = self.config.get(
+            "parallel_search_min_candidates",
+            self.DEFAULT_CONFIG["parallel_search_min_candidates"],
+        )
+        if isinstance(value, int) and not isinstance(value, bool) and value >= 0:
+            return value
+        diagnostics.warning(
+            f"Invalid parallel_search_min_candidates value: {value}. Using default (200000)."
+        )
+        return 200000
+
+    def get_query_cache_max_mb(self) -> float:
+        """Get the size bound of the query result cache in MB (0 disables it)."""
+        value = self.config.get("query_cache_max_mb", self.DEFAULT_CONFIG["query_cache_max_mb"])
+        if isinstance(value, (int, float)) and not isinstance(value, bool) and value >= 0:
+            return float(value)
+        diagnostics.warning(f"Invalid query_cache_max_mb value: {value}. Using default (64).")
+        return 64.0
+
+    def get_fallback_time_budget_ms(self) -> float:
+        """Get the time budget of one smart fallback analysis in milliseconds."""
+        value = self.config.get(
+            "fallback_time_budget_ms", self.DEFAULT_CONFIG["fallback_time_budget_ms"]
+        )
+        if isinstance(value, (int, float)) and not isinstance(value, bool) and value > 0:
+            return float(value)
+        diagnostics.warning(f"Invalid fallback_time_budget_ms value: {value}. Using default (50).")
+        return 50.0
+
+    def get_call_path_max_paths(self) -> int:
+        """Get the number of shortest paths returned by a call path query."""
+        value = self.config.get("call_path_max_paths", self.DEFAULT_CONFIG["call_path_max_paths"])
+        if isinstance(value, int) and not isinstance(value, bool) and value > 0:
+            return value
+        diagnostics.warning(f"Invalid call_path_max_paths value: {value}. Using default (10).")
+        return 10
+
+    def get_call_path_node_budget(self) -> int:
+        """Get the number of functions one call path query may expand."""
+        value = self.config.get(
+            "call_path_node_budget", self.DEFAULT_CONFIG["call_path_node_budget"]
+        )
+        if isinstance(value, int) and not isinstance(value, bool) and value > 0:
+            return value
+        diagnostics.warning(
+            f"Invalid call_path_node_budget value: {value}. Using default (200000)."
+        )
+        return 200000
+
+    def get_call_path_timeout_ms(self) -> float:
+        """Get the wall-clock limit of one call path query in milliseconds."""
+        value = self.config.get("call_path_timeout_ms", self.DEFAULT_CONFIG["call_path_timeout_ms"])
+        if isinstance(value, (int, float)) and not isinstance(value, bool) and value > 0:
+            return float(value)
+        diagnostics.warning(f"Invalid call_path_timeout_ms value: {value}. Using default (5000).")
+        return 5000.0
+
     def get_query_behavior_policy(self) -> str:
         """Get query behavior policy during indexing.
 
@@ -264,6 +345,13 @@ class CppAnalyzerConfig:
             "max_file_size_mb": 10,
             "max_workers": None,
             "_max_workers_comment": "Set to integer (e.g., 8) to limit memory usage (~1.2 GB per worker)",
+            "search_workers": 1,
+            "query_cache_max_mb": 64,
+            "fallback_time_budget_ms": 50,
+            "call_path_max_paths": 10,
+            "call_path_node_budget": 200000,
+            "call_path_timeout_ms": 5000,
+            "_search_workers_comment": "Set >1 (0 = cpu_count) to search large indexes in parallel",
             "query_behavior": "allow_partial",
             "_query_behavior_options": [
                 "allow_partial - Allow queries during indexing (results may be incomplete)",
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""Scaling benchmark for sharded parallel function search.
+
+Builds a synthetic SymbolIndexStore (2M functions by default, no libclang
+needed) and times function searches that have to verify the whole index -
+regex patterns, a class filter and a signature_pattern made only of common
+tokens - with search_workers = 1, 2, 4, 8, 16.  Queries narrowed by the
+signature token index or the namespace tree never reach the workers and are
+deliberately left out.
+
+The first query after (re)sharding pays a one-time shard load; it is reported
+separately from the steady-state query times.
+
+Usage:
+    python scripts/benchmark_parallel_search.py
+    python scripts/benchmark_parallel_search.py --functions 500000 --workers 1,4,8
+    python scripts/benchmark_parallel_search.py --repeat 5
+"""
+
+import argparse
+import os
+import statistics
+import sys
+import threading
+import time
+from types import SimpleNamespace
+from typing import List, Optional, Tuple
+
+sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), "..")))
+
+from clang_index_mcp._search.parallel_search import (  # noqa: E402
+    ParallelFunctionSearch,
+    free_threading_active,
+)
+from clang_index_mcp._search.search_criteria import SearchCriteria  # noqa: E402
+from clang_index_mcp._search.search_engine import SearchEngine  # noqa: E402
+from clang_index_mcp._symbols.model import SymbolInfo  # noqa: E402
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore  # noqa: E402
+
+# Every query must reach ParallelFunctionSearch: no namespace filter, and
+# signature patterns only made of tokens too common to be indexed.
+QUERIES = [
+    ("regex", SearchCriteria(pattern=r"app::mod1\d::.*Handler.*")),
+    ("regex+class", SearchCriteria(pattern=".*process.*", class_name="Class43Handler")),
+    (
+        "regex+signature",
+        SearchCriteria(pattern=r".*compute1\d\d", signature_pattern="int count) const"),
+    ),
+]
+
+# Matches nothing but still verifies every function; used to load the shards.
+LOAD_QUERY = SearchCriteria(pattern=r"#none#.*")
+
+TYPES = ["int", "void", "bool", "double", "std::string", "Widget"]
+
+
+def build_store(function_count: int) -> SymbolIndexStore:
+    """Build a SymbolIndexStore holding synthetic functions and methods."""
+    store = SymbolIndexStore(
+        lock_provider=threading.RLock(),
+        alias_persistence=None,
+        cache_manager=None,
+        call_graph_port=SimpleNamespace(process_call_buffer=lambda calls: None),
+    )
+    symbols = []
+    for i in range(function_count):
+        module = i % 100
+        cls = f"Class{i % 5000}Handler" if i % 4 else ""
+        name = f"process{i % 20000}" if i % 2 else f"compute{i % 20000}"
+        namespace = f"app::mod{module}"
+        qualified = f"{namespace}::{cls}::{name}" if cls else f"{namespace}::{name}"
+        ret = TYPES[i % len(TYPES)]
+        signature = f"{ret} {name}(const Widget{i % 50} &w, int count) const"
+        symbols.append(
+            SymbolInfo(
+                name=name,
+                kind="method" if cls else "function",
+                file=f"/proj/src/mod{module}/file{i % 3000}.cpp",
+                line=i % 5000 + 1,
+                column=1,
+                qualified_name=qualified,
+                signature=signature,
+                namespace=namespace,
+                parent_class=cls,
+                is_virtual=bool(cls) and i % 7 == 0,
+                usr=f"c:@N@app@N@mod{module}@F@{name}#{i}",
+            )
+        )
+    store.bulk_write_symbols(symbols, [], [])
+    return store
+
+
+class CountingSearch(ParallelFunctionSearch):
+    """ParallelFunctionSearch that counts the queries its workers answered."""
+
+    def __init__(self, workers: int) -> None:
+        super().__init__(workers=workers, min_candidates=0)
+        self.fan_outs = 0
+
+    def search(self, store, args) -> Optional[List[SymbolInfo]]:
+        matched = super().search(store, args)
+        if matched is not None:
+            self.fan_outs += 1
+        return matched
+
+
+def run_queries(engine: SearchEngine, repeat: int) -> Tuple[List[float], List[int]]:
+    """Return the median wall time and the result count per query over `repeat` runs."""
+    medians = []
+    counts = []
+    for _, criteria in QUERIES:
+        times = []
+        for _ in range(repeat):
+            start = time.perf_counter()
+            results = engine.search_functions(criteria)
+            times.append(time.perf_counter() - start)
+        medians.append(statistics.median(times))
+        counts.append(len(results))
+    return medians, counts
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--functions", type=int, default=2_000_000, help="Index size")
+    parser.add_argument("--workers", default="1,2,4,8,16", help="Comma-separated worker counts")
+    parser.add_argument("--repeat", type=int, default=3, help="Runs per query (median taken)")
+    args = parser.parse_args()
+
+    worker_counts = [int(w) for w in args.workers.split(",")]
+    mode = "threads (free-threaded)" if free_threading_active() else "processes"
+    print(f"Building synthetic index: {args.functions:,} functions ...")
+    start = time.perf_counter()
+    store = build_store(args.functions)
+    print(f"  built in {time.perf_counter() - start:.1f}s; cpu_count={os.cpu_count()}, {mode}\n")
+
+    header = f"{'workers':>7}  {'load (s)':>8}  " + "  ".join(f"{q[0]:>18}" for q in QUERIES)
+    print(header)
+    print("-" * len(header))
+
+    baseline = None
+    baseline_counts = None
+    for workers in worker_counts:
+        search = CountingSearch(workers)
+        engine = SearchEngine(symbol_store=store, parallel_search=search)
+        try:
+            start = time.perf_counter()
+            engine.search_functions(LOAD_QUERY)
+            load_time = time.perf_counter() - start if search.enabled else 0.0
+
+            medians, counts = run_queries(engine, args.repeat)
+        finally:
+            search.close()
+
+        if search.enabled and search.fan_outs != 1 + len(QUERIES) * args.repeat:
+            sys.exit(f"workers={workers}: only {search.fan_outs} queries reached the workers")
+        if baseline is None:
+            baseline = medians
+            baseline_counts = counts
+        elif counts != baseline_counts:
+            sys.exit(f"workers={workers}: result counts {counts} != {baseline_counts}")
+        cells = [
+            f"{m:8.3f}s ({b / m:4.1f}x)" if m > 0 else f"{m:8.3f}s"
+            for m, b in zip(medians, baseline)
+        ]
+        print(f"{workers:>7}  {load_time:>8.2f}  " + "  ".join(f"{c:>18}" for c in cells))
+
+
+if __name__ == "__main__":
+    main()
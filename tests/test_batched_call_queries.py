@@ -0,0 +1,136 @@
+"""
+Tests for the batched incoming/outgoing call queries.
+
+find_incoming_calls, find_callees and get_call_sites fetch the call sites of
+all target overloads in one query and resolve the USRs they reference in one
+symbol lookup, instead of querying per target and per caller/callee.
+"""
+
+import shutil
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+from types import SimpleNamespace
+from unittest.mock import MagicMock, patch
+
+from clang_index_mcp._persistence.sqlite_cache_backend import SqliteCacheBackend
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+
+def _function(name, usr, line, is_project=True):
+    return SymbolInfo(
+        name=name,
+        kind="function",
+        file="/proj/a.cpp" if is_project else "/usr/include/lib.h",
+        line=line,
+        column=1,
+        qualified_name=name,
+        is_project=is_project,
+        usr=usr,
+    )
+
+
+# Two overloads of "draw", called from main and render; draw calls helper,
+# an external function stored only in SQLite, and std::make_shared<Widget>.
+SYMBOLS = [
+    _function("draw", "c:@F@draw#I#", 10),
+    _function("draw", "c:@F@draw#d#", 20),
+    _function("main", "c:@F@main", 30),
+    _function("render", "c:@F@render", 40),
+]
+EXTERNAL = _function("helper", "c:@F@helper", 5, is_project=False)
+CALLS = [
+    ("c:@F@main", "c:@F@draw#I#", 31),
+    ("c:@F@main", "c:@F@draw#d#", 32),
+    ("c:@F@render", "c:@F@draw#I#", 41),
+    ("c:@F@draw#I#", "c:@F@helper", 11),
+    ("c:@F@draw#d#", "c:@N@std@F@make_shared", 21),
+    ("c:@F@ext_caller", "c:@F@draw#d#", 3),
+]
+
+
+class FakeQueryEngine:
+    def search_functions(self, name, project_only=False, class_name=""):
+        return [
+            {"qualified_name": s.name, "definition": {"file": s.file, "line": s.line}}
+            for s in SYMBOLS
+            if s.name == name
+        ]
+
+
+class TestBatchedCallQueries(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_symbols_batch([EXTERNAL])
+        self.backend.save_call_sites_batch(
+            [
+                {"caller_usr": a, "callee_usr": b, "file": "/proj/a.cpp", "line": line}
+                for a, b, line in CALLS[:-2]
+            ]
+            + [
+                {
+                    "caller_usr": CALLS[-2][0],
+                    "callee_usr": CALLS[-2][1],
+                    "file": "/proj/a.cpp",
+                    "line": CALLS[-2][2],
+                    "display_name": "std::make_shared<Widget>",
+                    "template_project_types": '["Widget"]',
+                }
+            ]
+        )
+        cache_manager = SimpleNamespace(backend=self.backend, cache_dir=self.test_dir)
+        store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=cache_manager,
+            call_graph_port=MagicMock(),
+        )
+        store.bulk_write_symbols(list(SYMBOLS), [], [])
+        self.service = CallGraphService(cache_manager)
+        self.service.setup_cache_backend()
+        self.service.set_dependencies(store, FakeQueryEngine())
+        # A session call site that is not in SQLite yet
+        self.service.call_graph_analyzer.add_call(*CALLS[-1][:2], "/proj/ext.cpp", CALLS[-1][2])
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def test_incoming_calls_of_all_overloads_in_one_query(self):
+        batched_query = self.backend.get_call_sites_for_callees
+        with patch.object(
+            self.backend, "get_call_sites_for_callee", side_effect=AssertionError
+        ), patch.object(self.backend, "get_call_sites_for_callees", wraps=batched_query) as batched:
+            result = self.service.find_incoming_calls("draw", project_only=False)
+        self.assertEqual(batched.call_count, 1)
+
+        callers = sorted(c["qualified_name"] for c in result["callers"])
+        self.assertEqual(callers, ["ext_caller", "main", "main", "render"])
+        self.assertEqual(
+            [(cs["file"], cs["line"]) for cs in result["call_sites"]],
+            [("/proj/a.cpp", 31), ("/proj/a.cpp", 32), ("/proj/a.cpp", 41), ("/proj/ext.cpp", 3)],
+        )
+
+        projected = self.service.find_incoming_calls("draw")
+        self.assertEqual(len(projected["callers"]), 3)
+        self.assertEqual(projected["total_call_sites"], 3)
+
+    def test_callees_resolve_external_and_template_mediated(self):
+        result = self.service.find_callees("draw")
+        by_name = {c["qualified_name"]: c for c in result["callees"]}
+        # helper is resolved from SQLite in the same batched symbol lookup
+        self.assertFalse(by_name["helper"]["is_project"])
+        self.assertEqual(by_name["std::make_shared<Widget>"]["template_types"], ["Widget"])
+
+    def test_call_sites_from_all_overloads(self):
+        sites = self.service.get_call_sites("draw")
+        self.assertEqual([site["line"] for site in sites], [21])
+        self.assertTrue(sites[0]["is_template_mediated"])
+
+
+if __name__ == "__main__":
+    unittest.main()
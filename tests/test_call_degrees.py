@@ -0,0 +1,198 @@
+"""
+Tests for the per-function call degree counters (call_degrees) and call hotspots.
+
+call_degrees is adjusted by deltas on every call_sites insert and delete, so
+it must always equal a recount of call_sites; hotspot queries read it instead
+of aggregating call_sites.
+"""
+
+import shutil
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+from types import SimpleNamespace
+from unittest.mock import MagicMock
+
+from clang_index_mcp._persistence.sqlite_cache_backend import SqliteCacheBackend
+from clang_index_mcp._search.call_graph import CallGraphAnalyzer
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+
+def _usr(name):
+    return f"c:@F@{name}"
+
+
+def _function(name, is_project=True, **kwargs):
+    return SymbolInfo(
+        name=name,
+        kind=kwargs.pop("kind", "function"),
+        file="/proj/a.cpp" if is_project else "/usr/include/lib.h",
+        line=len(name),
+        column=1,
+        qualified_name=name,
+        is_project=is_project,
+        is_definition=True,
+        usr=_usr(name),
+        **kwargs,
+    )
+
+
+def _sites(file, edges):
+    return [
+        {"caller_usr": _usr(a), "callee_usr": _usr(b), "file": file, "line": i + 1}
+        for i, (a, b) in enumerate(edges)
+    ]
+
+
+# log is called from both files; helper and printf only from a.cpp
+A_CPP = [("main", "log"), ("main", "log"), ("main", "helper"), ("helper", "printf")]
+B_CPP = [("run", "log"), ("run", "helper")]
+
+SYMBOLS = [
+    _function("main"),
+    _function("log"),
+    _function("helper"),
+    _function("run"),
+    _function("unused"),
+    _function("onEvent", kind="method", is_virtual=True, parent_class="Handler"),
+    _function("Widget", kind="method", parent_class="Widget"),
+    _function("printf", is_project=False),
+]
+
+
+class TestCallDegreeCounters(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(_sites("/proj/a.cpp", A_CPP))
+        self.backend.save_call_sites_batch(_sites("/proj/b.cpp", B_CPP))
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def _recount(self):
+        """(usr, in_degree, out_degree) recounted from call_sites."""
+        rows = self.backend.conn.execute("""
+            SELECT u.usr,
+                   (SELECT COUNT(*) FROM call_sites WHERE callee_id = u.id),
+                   (SELECT COUNT(*) FROM call_sites WHERE caller_id = u.id)
+            FROM usr_ids u ORDER BY u.usr
+            """).fetchall()
+        return {row[0]: (row[1], row[2]) for row in rows if row[1] or row[2]}
+
+    def _counters(self):
+        rows = self.backend.conn.execute("""
+            SELECT u.usr, d.in_degree, d.out_degree
+            FROM call_degrees d JOIN usr_ids u ON u.id = d.usr_id
+            """).fetchall()
+        # Rows emptied by deletes must be gone, so no (0, 0) filtering here
+        return {row[0]: (row[1], row[2]) for row in rows}
+
+    def test_counters_follow_inserts_and_deletes(self):
+        self.assertEqual(self._counters(), self._recount())
+        self.assertEqual(self.backend.get_call_degrees([_usr("log")]), {_usr("log"): (3, 0)})
+
+        # File replacement, as in stream_call_sites
+        self.backend.delete_call_sites_by_file("/proj/b.cpp")
+        self.backend.save_call_sites_batch(_sites("/proj/b.cpp", [("run", "main")]))
+        self.assertEqual(self._counters(), self._recount())
+        self.assertEqual(self.backend.get_call_degrees([_usr("log")]), {_usr("log"): (2, 0)})
+
+        self.backend.delete_call_sites_by_usrs([_usr("helper"), _usr("main")])
+        self.assertEqual(self._counters(), self._recount())
+        self.assertEqual(self._counters(), {})
+
+    def test_top_degrees_and_totals(self):
+        self.assertEqual(
+            self.backend.get_top_call_degrees("in_degree", 2),
+            [(_usr("log"), 3, 0), (_usr("helper"), 2, 1)],
+        )
+        self.assertEqual(
+            self.backend.get_top_call_degrees("out_degree", 1), [(_usr("main"), 0, 3)]
+        )
+        self.assertEqual(
+            self.backend.get_call_degree_totals(),
+            {"functions_with_calls": 3, "functions_being_called": 3, "call_sites": 6},
+        )
+        with self.assertRaises(ValueError):
+            self.backend.get_top_call_degrees("file", 1)
+
+    def test_project_only_and_uncalled(self):
+        self.backend.save_symbols_batch(SYMBOLS)
+        project_top = self.backend.get_top_call_degrees("in_degree", 10, project_only=True)
+        self.assertNotIn(_usr("printf"), [row[0] for row in project_top])
+
+        # main, virtual methods and constructors are not dead code candidates
+        self.assertEqual(self.backend.get_uncalled_functions(10), [_usr("run"), _usr("unused")])
+        self.assertEqual(self.backend.get_uncalled_functions(1), [_usr("run")])
+
+
+class TestCallStatistics(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(_sites("/proj/a.cpp", A_CPP))
+        self.backend.save_symbols_batch(SYMBOLS)
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def test_statistics_merge_session_call_sites(self):
+        analyzer = CallGraphAnalyzer(self.backend)
+        # Session call sites not saved to SQLite yet
+        for line in (1, 2, 3):
+            analyzer.add_call(_usr("run"), _usr("helper"), "/proj/b.cpp", line)
+        analyzer.add_call(_usr("run"), _usr("unused"), "/proj/b.cpp", 4)
+
+        stats = analyzer.get_call_statistics(limit=2)
+        self.assertEqual(stats["total_functions_with_calls"], 3)
+        self.assertEqual(stats["total_functions_being_called"], 4)
+        self.assertEqual(stats["total_unique_calls"], 8)
+        self.assertEqual(stats["most_called_functions"], [(_usr("helper"), 4), (_usr("log"), 2)])
+        self.assertEqual(stats["functions_with_most_calls"], [(_usr("run"), 4), (_usr("main"), 3)])
+        self.assertEqual(analyzer.get_uncalled_functions(10), [_usr("run")])
+
+    def test_hotspots(self):
+        cache_manager = SimpleNamespace(backend=self.backend, cache_dir=self.test_dir)
+        store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=cache_manager,
+            call_graph_port=MagicMock(),
+        )
+        store.bulk_write_symbols(list(SYMBOLS), [], [])
+        service = CallGraphService(cache_manager)
+        service.setup_cache_backend()
+        service.set_dependencies(store, MagicMock())
+
+        hotspots = service.get_call_hotspots(limit=5)
+        self.assertEqual(
+            [(e["qualified_name"], e["call_count"]) for e in hotspots["most_called"]],
+            [("log", 2), ("helper", 1)],
+        )
+        self.assertEqual(
+            [(e["qualified_name"], e["calls_made"]) for e in hotspots["most_calls_made"]],
+            [("main", 3), ("helper", 1)],
+        )
+        self.assertEqual([e["qualified_name"] for e in hotspots["uncalled"]], ["run", "unused"])
+        self.assertEqual(
+            hotspots["totals"],
+            {
+                "functions_with_calls": 2,
+                "functions_being_called": 3,
+                "call_sites": 4,
+                "average_calls_made": 2.0,
+            },
+        )
+
+        everything = service.get_call_hotspots(limit=5, project_only=False)
+        self.assertIn("printf", [e["qualified_name"] for e in everything["most_called"]])
+
+
+if __name__ == "__main__":
+    unittest.main()
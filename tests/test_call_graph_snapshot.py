@@ -0,0 +1,184 @@
+"""
+Tests for the CSR call graph snapshot (CallGraphSnapshot).
+
+Traversals served from the snapshot must give the same answers as the
+per-node SQLite queries they replace, and the saved snapshot must be
+reused only while the call_sites table is unchanged.
+"""
+
+import shutil
+import tempfile
+import unittest
+from pathlib import Path
+from types import SimpleNamespace
+
+from clang_index_mcp._persistence.sqlite_cache_backend import SqliteCacheBackend
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._search.call_graph_snapshot import CallGraphSnapshot
+
+# main -> parse -> lex, main -> run -> step -> run (cycle), run -> log, parse -> log
+EDGES = [
+    ("main", "parse"),
+    ("parse", "lex"),
+    ("main", "run"),
+    ("run", "step"),
+    ("step", "run"),
+    ("run", "log"),
+    ("parse", "log"),
+]
+
+
+def _usr(name):
+    return f"c:@F@{name}"
+
+
+class FakeSymbolStore:
+    def __init__(self):
+        self.generation = 1
+
+    def get_symbol_by_usr(self, usr):
+        return SimpleNamespace(name=usr.rsplit("@", 1)[-1], parent_class="")
+
+
+class TestCallGraphSnapshot(unittest.TestCase):
+    def setUp(self):
+        names = sorted({name for edge in EDGES for name in edge})
+        ids = {name: i + 10 for i, name in enumerate(names)}
+        self.snapshot = CallGraphSnapshot.build(
+            [(ids[n], _usr(n)) for n in names],
+            [(ids[a], ids[b]) for a, b in EDGES + EDGES[:2]],
+            (7, 9, 9),
+        )
+        self.test_dir = Path(tempfile.mkdtemp())
+
+    def tearDown(self):
+        shutil.rmtree(self.test_dir)
+
+    def test_adjacency(self):
+        self.assertEqual(self.snapshot.edge_count, len(EDGES))
+        self.assertEqual(sorted(self.snapshot.callees(_usr("main"))), [_usr("parse"), _usr("run")])
+        self.assertEqual(sorted(self.snapshot.callers(_usr("log"))), [_usr("parse"), _usr("run")])
+        self.assertEqual(self.snapshot.callees(_usr("missing")), [])
+
+    def test_reachable(self):
+        self.assertEqual(
+            self.snapshot.reachable([_usr("main")], 1), {_usr("main"), _usr("parse"), _usr("run")}
+        )
+        self.assertEqual(len(self.snapshot.reachable([_usr("main")], 10)), 6)
+        self.assertEqual(
+            self.snapshot.reachable([_usr("lex")], 10, reverse=True),
+            {_usr("lex"), _usr("parse"), _usr("main")},
+        )
+
+    def test_save_and_memory_mapped_load(self):
+        path = self.test_dir / "call_graph.csr"
+        self.snapshot.save(path)
+        loaded = CallGraphSnapshot.load(path)
+        self.assertIsNotNone(loaded)
+        self.assertEqual(loaded.fingerprint, (7, 9, 9))
+        self.assertEqual(loaded.usrs, self.snapshot.usrs)
+        for usr in self.snapshot.usrs:
+            self.assertEqual(loaded.callees(usr), self.snapshot.callees(usr))
+            self.assertEqual(loaded.callers(usr), self.snapshot.callers(usr))
+
+    def test_load_rejects_garbage(self):
+        path = self.test_dir / "call_graph.csr"
+        path.write_bytes(b"not a snapshot")
+        self.assertIsNone(CallGraphSnapshot.load(path))
+        self.assertIsNone(CallGraphSnapshot.load(self.test_dir / "missing.csr"))
+
+
+class TestCallGraphServiceSnapshot(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(
+            [
+                {"caller_usr": _usr(a), "callee_usr": _usr(b), "file": "a.cpp", "line": i + 1}
+                for i, (a, b) in enumerate(EDGES)
+            ]
+        )
+        self.service = CallGraphService(
+            SimpleNamespace(backend=self.backend, cache_dir=self.test_dir)
+        )
+        self.service.setup_cache_backend()
+        self.service.symbol_store = FakeSymbolStore()
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def _paths(self, source, targets, max_depth=10):
+        """(target, path length) of each path; which parent reaches a node first may vary."""
+        paths = self.service._find_paths_bfs({_usr(source)}, set(targets), max_depth)
+        return sorted((path[-1], len(path)) for path in paths)
+
+    def test_paths_match_per_node_queries(self):
+        targets = [_usr("log"), _usr("lex")]
+        with_snapshot = self._paths("main", targets)
+        self.assertIsNotNone(self.service.call_graph_snapshot())
+        self.assertEqual(with_snapshot, [("lex", 3), ("log", 3), ("log", 3)])
+
+        self.service.cache_manager = SimpleNamespace(backend=None)
+        self.assertIsNone(self.service.call_graph_snapshot())
+        self.assertEqual(self._paths("main", targets), with_snapshot)
+        self.assertEqual(self._paths("main", targets, max_depth=2), [])
+
+    def test_snapshot_is_saved_and_refreshed_on_change(self):
+        self.service.refresh_call_graph_snapshot()
+        first = self.service.call_graph_snapshot()
+        self.assertTrue((self.test_dir / "call_graph.csr").exists())
+
+        self.backend.save_call_sites_batch(
+            [{"caller_usr": _usr("lex"), "callee_usr": _usr("log"), "file": "b.cpp", "line": 1}]
+        )
+        self.assertIs(self.service.call_graph_snapshot(), first)  # same generation
+        self.service.symbol_store.generation += 1
+        second = self.service.call_graph_snapshot()
+        self.assertIsNot(second, first)
+        self.assertEqual(second.callees(_usr("lex")), [_usr("log")])
+
+        reloaded = CallGraphSnapshot.load(self.test_dir / "call_graph.csr")
+        self.assertEqual(reloaded.fingerprint, second.fingerprint)
+
+    def test_streamed_call_sites_refresh_without_symbol_generation(self):
+        first = self.service.call_graph_snapshot()
+        call = {"caller_usr": _usr("lex"), "callee_usr": _usr("step"), "file": "b.cpp", "line": 2}
+        self.service.stream_call_sites("b.cpp", [call])
+        self.assertEqual(self.service.symbol_store.generation, 1)
+        second = self.service.call_graph_snapshot()
+        self.assertIsNot(second, first)
+        self.assertEqual(second.callees(_usr("lex")), [_usr("step")])
+
+    def test_fingerprint_counts_rows_without_scanning(self):
+        fingerprint = self.backend.get_call_graph_fingerprint()
+        self.assertEqual(fingerprint[1:], (len(EDGES), len(EDGES)))
+        self.backend.delete_call_sites_by_usr(_usr("lex"))
+        self.assertEqual(self.backend.get_call_graph_fingerprint()[1:], (len(EDGES) - 1, 7))
+
+        # Databases created before the count was kept are counted once
+        with self.backend.conn:
+            self.backend.conn.execute("DELETE FROM cache_metadata WHERE key = 'call_site_count'")
+        self.assertEqual(self.backend.get_call_graph_fingerprint()[1:], (len(EDGES) - 1, 7))
+
+    def test_snapshot_of_recreated_database_is_stale(self):
+        first = self.service.call_graph_snapshot()
+        self.backend.close()
+        (self.test_dir / "symbols.db").unlink()
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(
+            [{"caller_usr": _usr("lex"), "callee_usr": _usr("log"), "file": "a.cpp", "line": 1}]
+            * len(EDGES)
+        )
+        fingerprint = self.backend.get_call_graph_fingerprint()
+        self.assertEqual(fingerprint[1:], first.fingerprint[1:])
+        self.assertNotEqual(fingerprint, first.fingerprint)
+
+        service = CallGraphService(SimpleNamespace(backend=self.backend, cache_dir=self.test_dir))
+        service.setup_cache_backend()
+        service.symbol_store = FakeSymbolStore()
+        self.assertEqual(service.call_graph_snapshot().callees(_usr("lex")), [_usr("log")])
+
+
+if __name__ == "__main__":
+    unittest.main()
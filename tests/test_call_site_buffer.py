@@ -0,0 +1,115 @@
+"""
+Tests for the indexed in-session call-site buffer of CallGraphAnalyzer.
+
+Session call sites are indexed by caller and by callee; lookups and removals
+must match a full scan of the buffer, and removals made while merging a file
+must reach SQLite as one batch.
+"""
+
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+from clang_index_mcp._search.call_graph import CallGraphAnalyzer
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+
+def _function(name, line=1, is_definition=True, file="/proj/a.cpp"):
+    return SymbolInfo(
+        name=name,
+        kind="function",
+        file=file,
+        line=line,
+        column=1,
+        qualified_name=name,
+        usr=f"c:@F@{name}",
+        is_definition=is_definition,
+    )
+
+
+class TestIndexedCallSiteBuffer(unittest.TestCase):
+    def setUp(self):
+        self.analyzer = CallGraphAnalyzer()
+        for i in range(30):
+            self.analyzer.add_call(f"f{i % 5}", f"f{(i * 7) % 11}", "a.cpp", i + 1)
+
+    def _scan(self, usr, callers):
+        if callers:
+            return {cs.caller_usr for cs in self.analyzer.call_sites if cs.callee_usr == usr}
+        return {cs.callee_usr for cs in self.analyzer.call_sites if cs.caller_usr == usr}
+
+    def test_lookups_match_full_scan(self):
+        for i in range(12):
+            usr = f"f{i}"
+            self.assertEqual(self.analyzer.find_incoming_calls(usr), self._scan(usr, True))
+            self.assertEqual(self.analyzer.find_callees(usr), self._scan(usr, False))
+            self.assertEqual(
+                set(self.analyzer.get_call_sites_for_callee(usr)),
+                {cs for cs in self.analyzer.call_sites if cs.callee_usr == usr},
+            )
+
+    def test_duplicates_are_ignored(self):
+        before = len(self.analyzer.call_sites)
+        self.analyzer.add_call("f0", "f0", "a.cpp", 1)
+        self.assertEqual(len(self.analyzer.call_sites), before)
+
+    def test_remove_symbols_keeps_indexes_consistent(self):
+        self.analyzer.remove_symbols(["f0", "f7"])
+        remaining = self.analyzer.call_sites
+        self.assertTrue(remaining)
+        self.assertFalse(
+            [cs for cs in remaining if {cs.caller_usr, cs.callee_usr} & {"f0", "f7"}]
+        )
+        for i in range(12):
+            usr = f"f{i}"
+            self.assertEqual(self.analyzer.find_incoming_calls(usr), self._scan(usr, True))
+            self.assertEqual(self.analyzer.find_callees(usr), self._scan(usr, False))
+
+        self.analyzer.clear()
+        self.assertEqual(self.analyzer.find_callees("f1"), set())
+
+    def test_remove_symbols_deletes_in_one_backend_call(self):
+        backend = MagicMock()
+        backend.get_call_sites_for_callee.return_value = []
+        backend.get_call_sites_for_caller.return_value = []
+        self.analyzer.cache_backend = backend
+        self.analyzer.remove_symbols(["f3", "f1", "f3"])
+        backend.delete_call_sites_by_usrs.assert_called_once_with(["f1", "f3"])
+        backend.delete_call_sites_by_usr.assert_not_called()
+
+
+class TestMergeBatchesCallGraphRemovals(unittest.TestCase):
+    def setUp(self):
+        self.port = MagicMock()
+        self.store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=self.port,
+        )
+        self.store.bulk_write_symbols(
+            [_function("a"), _function("b", 2), _function("c", 3, is_definition=False)], [], []
+        )
+        self.port.reset_mock()
+
+    def test_merge_file_symbols_removes_in_one_batch(self):
+        self.store.merge_file_symbols("/proj/a.cpp", [_function("a"), _function("d", 4)])
+        self.port.remove_symbols.assert_called_once()
+        self.assertEqual(
+            sorted(self.port.remove_symbols.call_args[0][0]), ["c:@F@a", "c:@F@b", "c:@F@c"]
+        )
+        self.port.remove_symbol.assert_not_called()
+        self.assertIn("c:@F@d", self.store.usr_index)
+
+    def test_definition_wins_removals_precede_new_calls(self):
+        self.store.bulk_write_symbols(
+            [_function("c", 3, file="/proj/b.cpp")], [MagicMock(name="call")], []
+        )
+        names = [name for name, _, _ in self.port.mock_calls]
+        self.assertEqual(names, ["remove_symbols", "process_call_buffer"])
+        self.assertEqual(self.port.remove_symbols.call_args[0][0], ["c:@F@c"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,196 @@
+"""
+Tests for keyset-paginated call site queries.
+
+find_incoming_calls with a page size returns the call sites in
+(file, line, caller, callee) order one page at a time, with an opaque
+continuation token; every page reads a bounded number of rows per callee.
+"""
+
+import shutil
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+from types import SimpleNamespace
+from unittest.mock import MagicMock
+
+from clang_index_mcp._persistence.sqlite_cache_backend import SqliteCacheBackend
+from clang_index_mcp._search.call_graph import (
+    CallGraphAnalyzer,
+    call_site_key,
+    decode_page_token,
+    encode_page_token,
+)
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+LOG_INT = "c:@F@log#I#"
+LOG_STR = "c:@F@log#*C#"
+
+
+def _calls():
+    """Two overloads of log called from 12 places over three files."""
+    sites = []
+    for i in range(12):
+        sites.append(
+            {
+                "caller_usr": f"c:@F@caller{i % 4}",
+                "callee_usr": LOG_INT if i % 3 else LOG_STR,
+                "file": f"/proj/{'abc'[i % 3]}.cpp",
+                "line": 10 + i // 2,
+            }
+        )
+    return sites
+
+
+class TestPageTokens(unittest.TestCase):
+    def test_round_trip(self):
+        key = ("/proj/a.cpp", 12, "c:@F@main", LOG_INT)
+        self.assertEqual(decode_page_token(encode_page_token(key)), key)
+
+    def test_malformed_tokens_are_rejected(self):
+        for token in ("not a token", encode_page_token(("a", "b", "c", "d"))[:-2], "WzFd"):
+            with self.assertRaises(ValueError):
+                decode_page_token(token)
+
+
+class TestCallSitePages(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(_calls()[:10])
+        self.analyzer = CallGraphAnalyzer(self.backend)
+        # Session call sites not saved to SQLite yet, one of them also stored
+        for site in _calls()[9:]:
+            self.analyzer.add_call(
+                site["caller_usr"], site["callee_usr"], site["file"], site["line"]
+            )
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def test_repository_page_is_ordered_and_inclusive(self):
+        first = self.backend.get_call_sites_page_for_callee(LOG_INT, None, 3)
+        keys = [(r["file"], r["line"], r["caller_usr"]) for r in first]
+        self.assertEqual(keys, sorted(keys))
+        self.assertEqual(len(keys), 3)
+        again = self.backend.get_call_sites_page_for_callee(LOG_INT, keys[-1], 2)
+        self.assertEqual((again[0]["file"], again[0]["line"], again[0]["caller_usr"]), keys[-1])
+
+    def test_pages_cover_all_call_sites_once(self):
+        expected = [
+            call_site_key(cs) for cs in self.analyzer.get_call_sites_for_callees({LOG_INT, LOG_STR})
+        ]
+        self.assertEqual(len(expected), 12)
+        for page_size in (1, 2, 5, 12, 20):
+            seen, after = [], None
+            while True:
+                page, after = self.analyzer.get_call_sites_page_for_callees(
+                    [LOG_INT, LOG_STR], after, page_size
+                )
+                self.assertLessEqual(len(page), page_size)
+                seen.extend(call_site_key(cs) for cs in page)
+                if after is None:
+                    break
+            self.assertEqual(seen, sorted(expected), f"page_size={page_size}")
+
+    def test_same_line_calls_do_not_end_paging(self):
+        callee = "c:@F@max"
+        self.backend.save_call_sites_batch(
+            [
+                {
+                    "caller_usr": "c:@F@main",
+                    "callee_usr": callee,
+                    "file": "/proj/m.cpp",
+                    "line": line,
+                    "column": column,
+                }
+                for line, column in ((10, 5), (10, 20), (10, 35), (20, 5))
+            ]
+        )
+        expected = [call_site_key(cs) for cs in self.analyzer.get_call_sites_for_callees({callee})]
+        self.assertEqual([key[1] for key in expected], [10, 20])
+        seen, after = [], None
+        while True:
+            page, after = self.analyzer.get_call_sites_page_for_callees([callee], after, 1)
+            seen.extend(call_site_key(cs) for cs in page)
+            if after is None:
+                break
+        self.assertEqual(seen, expected)
+
+
+class TestPaginatedIncomingCalls(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(_calls())
+        symbols = [
+            SymbolInfo(
+                name="log",
+                kind="function",
+                file="/proj/log.h",
+                line=line,
+                column=1,
+                qualified_name="log",
+                usr=usr,
+            )
+            for usr, line in ((LOG_INT, 1), (LOG_STR, 2))
+        ] + [
+            SymbolInfo(
+                name=f"caller{i}",
+                kind="function",
+                file="/proj/a.cpp",
+                line=i,
+                column=1,
+                qualified_name=f"caller{i}",
+                usr=f"c:@F@caller{i}",
+            )
+            for i in range(4)
+        ]
+        cache_manager = SimpleNamespace(backend=self.backend, cache_dir=self.test_dir)
+        store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=cache_manager,
+            call_graph_port=MagicMock(),
+        )
+        store.bulk_write_symbols(symbols, [], [])
+        query_engine = MagicMock()
+        query_engine.search_functions.return_value = [
+            {"qualified_name": "log", "definition": {"file": "/proj/log.h", "line": line}}
+            for line in (1, 2)
+        ]
+        self.service = CallGraphService(cache_manager)
+        self.service.setup_cache_backend()
+        self.service.set_dependencies(store, query_engine)
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def test_pages_follow_next_cursor(self):
+        everything = self.service.find_incoming_calls("log")
+        self.assertNotIn("next_cursor", everything)
+
+        lines, cursor, pages = [], None, 0
+        while True:
+            page = self.service.find_incoming_calls("log", page_size=5, cursor=cursor)
+            pages += 1
+            self.assertLessEqual(len(page["call_sites"]), 5)
+            self.assertLessEqual(len(page["callers"]), 5)
+            lines.extend((cs["file"], cs["line"]) for cs in page["call_sites"])
+            cursor = page.get("next_cursor")
+            if cursor is None:
+                break
+        self.assertEqual(pages, 3)
+        self.assertEqual(lines, sorted((cs["file"], cs["line"]) for cs in everything["call_sites"]))
+
+    def test_invalid_cursor(self):
+        with self.assertRaises(ValueError):
+            self.service.find_incoming_calls("log", cursor="bogus")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,115 @@
+"""
+Tests for CallSiteRepository on the integer-keyed call_sites layout.
+
+call_sites stores usr_ids ids; the repository must accept and return USRs
+exactly as before and store every USR string only once.
+"""
+
+import sqlite3
+import unittest
+from pathlib import Path
+from unittest.mock import patch
+
+from clang_index_mcp._persistence.repositories import call_site_repository
+from clang_index_mcp._persistence.repositories.call_site_repository import CallSiteRepository
+
+SCHEMA = Path(__file__).parent.parent / "clang_index_mcp" / "_persistence" / "schema.sql"
+
+
+def _call(caller, callee, file="a.cpp", line=1, **extra):
+    return {"caller_usr": caller, "callee_usr": callee, "file": file, "line": line, **extra}
+
+
+class TestCallSiteRepository(unittest.TestCase):
+    def setUp(self):
+        self.conn = sqlite3.connect(":memory:")
+        self.conn.row_factory = sqlite3.Row
+        self.conn.executescript(SCHEMA.read_text())
+        self.repo = CallSiteRepository(lambda: self.conn)
+        self.repo.save_call_sites_batch(
+            [
+                _call("c:@F@main", "c:@F@run", line=3, column=5),
+                _call("c:@F@main", "c:@F@stop", line=4),
+                _call("c:@F@run", "c:@F@stop", "b.cpp", 9, template_project_types='["W"]'),
+            ]
+        )
+
+    def tearDown(self):
+        self.conn.close()
+
+    def test_usrs_are_stored_once(self):
+        count = self.conn.execute("SELECT COUNT(*) FROM usr_ids").fetchone()[0]
+        self.assertEqual(count, 3)
+        self.repo.save_call_sites_batch([_call("c:@F@main", "c:@F@run", line=7)])
+        count = self.conn.execute("SELECT COUNT(*) FROM usr_ids").fetchone()[0]
+        self.assertEqual(count, 3)
+
+    def test_queries_return_usrs(self):
+        callees = self.repo.get_call_sites_for_caller("c:@F@main")
+        self.assertEqual([c["callee_usr"] for c in callees], ["c:@F@run", "c:@F@stop"])
+        self.assertEqual(callees[0]["column"], 5)
+
+        callers = self.repo.get_call_sites_for_callee("c:@F@stop")
+        self.assertEqual([c["caller_usr"] for c in callers], ["c:@F@main", "c:@F@run"])
+        self.assertEqual(self.repo.get_call_sites_for_caller("c:@F@unknown"), [])
+
+        everything = self.repo.load_all_call_sites()
+        self.assertEqual(len(everything), 3)
+        self.assertEqual(everything[0]["caller_usr"], "c:@F@main")
+
+    def test_batched_queries(self):
+        sites = self.repo.get_call_sites_for_callees(["c:@F@stop", "c:@F@run", "c:@F@unknown"])
+        self.assertEqual(
+            [(c["caller_usr"], c["callee_usr"], c["line"]) for c in sites],
+            [
+                ("c:@F@main", "c:@F@run", 3),
+                ("c:@F@main", "c:@F@stop", 4),
+                ("c:@F@run", "c:@F@stop", 9),
+            ],
+        )
+        with patch.object(call_site_repository, "_IN_BATCH", 1):
+            self.assertEqual(
+                self.repo.get_call_sites_for_callees(["c:@F@stop", "c:@F@run"]), sites
+            )
+        sites = self.repo.get_call_sites_for_callers(["c:@F@run"])
+        self.assertEqual(sites[0]["template_project_types"], '["W"]')
+        self.assertEqual(self.repo.get_call_sites_for_callers([]), [])
+
+    def test_delete_by_usr_and_file(self):
+        self.assertEqual(self.repo.delete_call_sites_by_usr("c:@F@unknown"), 0)
+        self.assertEqual(self.repo.delete_call_sites_by_usr("c:@F@run"), 2)
+        self.assertEqual(self.repo.delete_call_sites_by_file("a.cpp"), 1)
+        self.assertEqual(self.repo.load_all_call_sites(), [])
+
+    def test_delete_by_usrs_in_one_batch(self):
+        self.assertEqual(self.repo.delete_call_sites_by_usrs([]), 0)
+        with patch.object(call_site_repository, "_IN_BATCH", 1):
+            self.assertEqual(self.repo.delete_call_sites_by_usrs(["c:@F@run", "c:@F@stop"]), 3)
+        self.assertEqual(self.repo.load_all_call_sites(), [])
+
+    def test_reachable_usrs(self):
+        # Cycle back to main and a second, longer route to stop
+        self.repo.save_call_sites_batch(
+            [_call("c:@F@stop", "c:@F@main", line=12), _call("c:@F@stop", "c:@F@log", line=13)]
+        )
+        self.assertEqual(
+            self.repo.get_reachable_usrs(["c:@F@main"], 5, False, 10),
+            [("c:@F@run", 1), ("c:@F@stop", 1), ("c:@F@log", 2)],
+        )
+        self.assertEqual(
+            self.repo.get_reachable_usrs(["c:@F@log"], 2, True, 10),
+            [("c:@F@stop", 1), ("c:@F@main", 2), ("c:@F@run", 2)],
+        )
+        self.assertEqual(
+            self.repo.get_reachable_usrs(["c:@F@main"], 5, False, 1), [("c:@F@run", 1)]
+        )
+        with patch.object(call_site_repository, "_IN_BATCH", 1):
+            self.assertEqual(
+                self.repo.get_reachable_usrs(["c:@F@main", "c:@F@run"], 1, False, 10),
+                [("c:@F@stop", 1)],
+            )
+        self.assertEqual(self.repo.get_reachable_usrs(["c:@F@unknown"], 5, False, 10), [])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,158 @@
+"""
+Tests for the per-class get_class_info memo (payloads reused across calls
+and dropped when a file they were built from, or a file adding members to
+the class, is re-indexed) and for get_class_info_batch.
+"""
+
+import threading
+import unittest
+from types import SimpleNamespace
+from unittest.mock import MagicMock, patch
+
+from clang_index_mcp._search import inheritance_closure
+from clang_index_mcp._search.query_engine import QueryEngine
+from clang_index_mcp._search.search_engine import SearchEngine
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+
+def _symbol(name, kind, file, line, parent="", **fields):
+    qualified = f"ui::{parent}::{name}" if parent else f"ui::{name}"
+    return SymbolInfo(
+        name=name,
+        kind=kind,
+        file=file,
+        line=line,
+        column=1,
+        qualified_name=qualified,
+        signature=f"void {name}()" if kind == "method" else "",
+        is_project=True,
+        is_definition=True,
+        parent_class=parent,
+        usr=f"c:@N@ui@{qualified}",
+        **fields,
+    )
+
+
+def _indexed_store():
+    store = SymbolIndexStore(
+        lock_provider=threading.RLock(),
+        alias_persistence=MagicMock(),
+        cache_manager=MagicMock(),
+        call_graph_port=MagicMock(),
+    )
+    store.bulk_write_symbols(
+        [
+            _symbol("Widget", "class", "/proj/widget.h", 1),
+            _symbol("show", "method", "/proj/widget.h", 3, "Widget"),
+            _symbol("Dialog", "class", "/proj/dialog.h", 1),
+            _symbol("exec", "method", "/proj/dialog.h", 3, "Dialog"),
+        ],
+        [],
+        [],
+    )
+    return store
+
+
+class TestClassInfoMemo(unittest.TestCase):
+    def setUp(self):
+        self.store = _indexed_store()
+        self.engine = SearchEngine(symbol_store=self.store)
+
+    def _methods(self, info):
+        return [m["qualified_name"] for m in info["methods"]]
+
+    def _count_builds(self):
+        return patch.object(
+            SearchEngine, "_find_class_methods", wraps=self.engine._find_class_methods
+        )
+
+    def test_repeated_calls_reuse_payload(self):
+        fresh = SearchEngine(symbol_store=self.store).get_class_info("Widget")
+        with self._count_builds() as build:
+            self.assertEqual(self.engine.get_class_info("Widget"), fresh)
+            self.assertEqual(self.engine.get_class_info("ui::Widget"), fresh)
+            self.assertEqual(build.call_count, 1)
+
+    def test_unrelated_reindex_keeps_payload(self):
+        self.engine.get_class_info("Widget")
+        self.store.remove_file("/proj/dialog.h")
+        self.store.bulk_write_symbols([_symbol("Dialog", "class", "/proj/dialog.h", 1)], [], [])
+        with self._count_builds() as build:
+            self.engine.get_class_info("Widget")
+            self.assertEqual(build.call_count, 0)
+            self.assertEqual(self._methods(self.engine.get_class_info("Dialog")), [])
+            self.assertEqual(build.call_count, 1)
+
+    def test_members_from_other_files_invalidate(self):
+        self.engine.get_class_info("Widget")
+        # Out-of-line definition in a file the payload was not built from
+        hide = _symbol("hide", "method", "/proj/widget.cpp", 10, "Widget")
+        self.store.bulk_write_symbols([hide], [], [])
+        info = self.engine.get_class_info("Widget")
+        self.assertEqual(self._methods(info), ["ui::Widget::show", "ui::Widget::hide"])
+
+        self.store.remove_file("/proj/widget.cpp")
+        self.assertEqual(self._methods(self.engine.get_class_info("Widget")), ["ui::Widget::show"])
+        self.store.clear_all_indexes()
+        self.assertIsNone(self.engine.get_class_info("Widget"))
+
+    def test_payloads_are_private_copies(self):
+        self.engine.get_class_info("Widget")["methods"].clear()
+        self.assertEqual(self._methods(self.engine.get_class_info("Widget")), ["ui::Widget::show"])
+
+
+class TestClassInfoBatch(unittest.TestCase):
+    def test_batch_matches_single_lookups(self):
+        store = _indexed_store()
+        other = _symbol("Dialog", "class", "/proj/core.h", 1)
+        other.qualified_name, other.usr = "core::Dialog", "c:@N@core@S@Dialog"
+        store.bulk_write_symbols([other], [], [])
+        engine = QueryEngine(
+            symbol_store=store,
+            cache_manager=MagicMock(),
+            concurrency=SimpleNamespace(index_lock=store.index_lock),
+            compilation_env=MagicMock(),
+            call_graph_service=MagicMock(),
+            project_root=MagicMock(),
+        )
+
+        batch = engine.get_class_info_batch(["Widget", "ui::Dialog", "Dialog", "Nope", "Widget"])
+        self.assertEqual((batch["total"], batch["found"]), (4, 2))
+        widget, dialog, ambiguous, missing = batch["classes"]
+        self.assertEqual(widget, {"class_name": "Widget", **engine.get_class_info("Widget")})
+        self.assertEqual(dialog["qualified_name"], "ui::Dialog")
+        self.assertTrue(ambiguous["is_ambiguous"])
+        self.assertEqual(ambiguous["class_name"], "Dialog")
+        self.assertEqual(missing, {"class_name": "Nope", "error": "Class 'Nope' not found"})
+
+    def test_shared_subclass_looked_up_once(self):
+        store = _indexed_store()
+        panel = _symbol("Panel", "class", "/proj/panel.h", 1)
+        panel.base_classes = ["ui::Widget", "ui::Dialog"]
+        store.bulk_write_symbols([panel], [], [])
+        engine = QueryEngine(
+            symbol_store=store,
+            cache_manager=MagicMock(),
+            concurrency=SimpleNamespace(index_lock=store.index_lock),
+            compilation_env=MagicMock(),
+            call_graph_service=MagicMock(),
+            project_root=MagicMock(),
+        )
+        engine.get_inheritance_closure()
+
+        lookup = inheritance_closure.lookup_class_infos
+        with patch.object(inheritance_closure, "lookup_class_infos", wraps=lookup) as spy:
+            batch = engine.get_class_info_batch(["Widget", "ui::Dialog"])
+        panel_lookups = [c for c in spy.call_args_list if c.args[0] == "ui::Panel"]
+        self.assertEqual(len(panel_lookups), 1)
+
+        for entry, name in zip(batch["classes"], ["Widget", "ui::Dialog"]):
+            self.assertEqual(
+                entry["derived_classes"], engine.get_class_info(name)["derived_classes"]
+            )
+            self.assertEqual([d["qualified_name"] for d in entry["derived_classes"]], ["ui::Panel"])
+
+
+if __name__ == "__main__":
+    unittest.main()
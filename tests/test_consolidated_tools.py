@@ -48,9 +48,9 @@ def _parse_tc(result: list[TextContent]) -> Any:
 class TestListToolsB:
     """Verify list_tools_b returns correct consolidated tool definitions."""
 
-    def test_exactly_10_tools(self) -> None:
+    def test_exactly_15_tools(self) -> None:
         tools = list_tools_b()
-        assert len(tools) == 10
+        assert len(tools) == 15
 
     def test_tool_names(self) -> None:
         tools = list_tools_b()
@@ -310,6 +310,11 @@ class TestHandleToolCallBRouting:
             "get_class_info",
             "get_class_hierarchy",
             "get_type_alias_info",
+            "list_namespaces",
+            "get_call_hotspots",
+            "get_class_hierarchy_stats",
+            "find_overrides",
+            "get_class_info_batch",
         ]
         for tool_name in passthrough:
             with patch(
@@ -599,6 +604,28 @@ class TestGetFunctionsCalledByRouting:
             assert "return_format" not in forwarded
             assert forwarded["search_scope"] == "project_code_only"
 
+    @pytest.mark.asyncio
+    async def test_max_depth_routes_to_transitive_callees(self) -> None:
+        with patch(
+            "clang_index_mcp._mcp.tool_registry.ToolRegistry.call_tool",
+            new_callable=AsyncMock,
+            return_value=_tc({"by_depth": []}),
+        ) as mock:
+            await handle_tool_call_b(
+                "find_outgoing_calls",
+                {
+                    "function_name": "f",
+                    "return_format": "function_definitions_full",
+                    "max_depth": 2,
+                },
+            )
+            assert mock.call_args[0][1] == "find_transitive_calls"
+            assert mock.call_args[0][2] == {
+                "function_name": "f",
+                "max_depth": 2,
+                "direction": "callees",
+            }
+
 
 class TestFindUsageSitesRouting:
     """Test find_incoming_calls → find_incoming_calls delegation."""
@@ -614,6 +641,39 @@ class TestFindUsageSitesRouting:
             await handle_tool_call_b("find_incoming_calls", args)
             mock.assert_called_once_with("_handle_tool_call", "find_incoming_calls", args)
 
+    @pytest.mark.asyncio
+    async def test_max_depth_routes_to_transitive_callers(self) -> None:
+        with patch(
+            "clang_index_mcp._mcp.tool_registry.ToolRegistry.call_tool",
+            new_callable=AsyncMock,
+            return_value=_tc({"by_depth": []}),
+        ) as mock:
+            await handle_tool_call_b(
+                "find_incoming_calls", {"function_name": "render", "max_depth": 3}
+            )
+            mock.assert_called_once_with(
+                "_handle_tool_call",
+                "find_transitive_calls",
+                {"function_name": "render", "max_depth": 3, "direction": "callers"},
+            )
+
+    @pytest.mark.asyncio
+    async def test_template_type_routes_to_template_call_sites(self) -> None:
+        with patch(
+            "clang_index_mcp._mcp.tool_registry.ToolRegistry.call_tool",
+            new_callable=AsyncMock,
+            return_value=_tc({"call_sites": []}),
+        ) as mock:
+            await handle_tool_call_b(
+                "find_incoming_calls",
+                {"function_name": "make_shared", "template_type": "Sensor", "max_depth": 2},
+            )
+            mock.assert_called_once_with(
+                "_handle_tool_call",
+                "find_template_call_sites",
+                {"template_type": "Sensor", "function_name": "make_shared"},
+            )
+
 
 class TestTraceExecutionPathRouting:
     """Test trace_execution_path → get_call_path delegation."""
@@ -778,4 +838,4 @@ class TestModuleImports:
 
         assert callable(list_tools_b)
         assert callable(handle_tool_call_b)  # type: ignore[arg-type]
-        assert len(TOOL_NAMES) == 10
+        assert len(TOOL_NAMES) == 15
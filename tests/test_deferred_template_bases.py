@@ -0,0 +1,93 @@
+"""
+Tests for the batched deferred base resolution of template instantiations
+and the memoized template parameter parsing it relies on.
+"""
+
+import json
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+from clang_index_mcp._symbols.model import SymbolInfo, template_parameter_names
+from clang_index_mcp._symbols.symbol_extractor import SymbolExtractor
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+
+def _template(name, bases, params):
+    return SymbolInfo(
+        name=name,
+        kind="class_template",
+        file="/proj/mixins.h",
+        line=1,
+        column=1,
+        qualified_name=f"app::{name}",
+        usr=f"c:@N@app@ST>1#T@{name}",
+        is_definition=True,
+        base_classes=bases,
+        template_parameters=json.dumps([{"name": p, "kind": "type"} for p in params]),
+    )
+
+
+def _instance(template, args):
+    return SymbolInfo(
+        name=template.name,
+        kind="class",
+        file="/proj/use.cpp",
+        line=1,
+        column=1,
+        qualified_name=f"app::{template.name}<{', '.join(args)}>",
+        usr=f"{template.usr}>#{'#'.join(args)}",
+        is_definition=True,
+        primary_template_usr=template.usr,
+        is_template_specialization=True,
+        template_arguments=json.dumps(args),
+    )
+
+
+class TestTemplateParameterNames(unittest.TestCase):
+    def test_names_in_order(self):
+        raw = json.dumps([{"name": "T"}, {"kind": "non_type"}, {"name": "Alloc"}])
+        self.assertEqual(template_parameter_names(raw), ("T", "", "Alloc"))
+        self.assertIs(template_parameter_names(raw), template_parameter_names(raw))
+
+    def test_missing_or_malformed(self):
+        self.assertEqual(template_parameter_names(None), ())
+        self.assertEqual(template_parameter_names("not json"), ())
+        self.assertEqual(template_parameter_names('{"name": "T"}'), ())
+
+
+class TestDeferredBaseResolution(unittest.TestCase):
+    def test_resolves_instantiations_grouped_by_primary(self):
+        crtp = _template("Crtp", ["Derived", "app::Counted"], ["Derived"])
+        pair = _template("PairBase", ["type-parameter-0-1"], ["A", "B"])
+        plain = _template("Plain", [], ["T"])
+        instances = [
+            _instance(crtp, ["app::Widget"]),
+            _instance(crtp, ["app::Button"]),
+            _instance(pair, ["int", "app::Right"]),
+            _instance(plain, ["int"]),
+        ]
+        store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=MagicMock(),
+        )
+        store.bulk_write_symbols([crtp, pair, plain] + instances, [], [])
+        extractor = SymbolExtractor(store, MagicMock(), MagicMock(), MagicMock(), MagicMock())
+
+        generation = store.generation
+        self.assertEqual(extractor.resolve_deferred_instantiation_bases(), 3)
+        self.assertGreater(store.generation, generation)
+        self.assertEqual(
+            [i.base_classes for i in instances],
+            [["app::Widget", "app::Counted"], ["app::Button", "app::Counted"], ["app::Right"], []],
+        )
+        self.assertIsNone(instances[0].template_arguments)
+        # The template without bases keeps its instantiation pending
+        self.assertEqual(instances[3].template_arguments, '["int"]')
+        self.assertEqual(extractor.resolve_deferred_instantiation_bases(), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,166 @@
+"""
+Tests for incremental maintenance of hierarchy structures: the class change
+journal of the inheritance index, and the hierarchy memo and inheritance
+closure brought up to date from it instead of being rebuilt.
+"""
+
+import json
+import threading
+import unittest
+from unittest.mock import MagicMock, patch
+
+from clang_index_mcp._search import hierarchy_analyzer
+from clang_index_mcp._search.hierarchy_analyzer import HierarchyMemo, get_class_hierarchy
+from clang_index_mcp._search.inheritance_closure import InheritanceClosure
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+from tests.utils.test_helpers import class_symbol
+
+
+CLASSES = [
+    class_symbol("Stream"),
+    class_symbol("Input", ["Stream"]),
+    class_symbol("Output", ["app::Stream"]),
+    class_symbol("IOStream", ["Input", "Output"]),
+    class_symbol(
+        "Logged",
+        ["T"],
+        kind="class_template",
+        template_parameters=json.dumps([{"name": "T", "kind": "type"}]),
+    ),
+    class_symbol("LoggedInput", ["Logged<app::Input>"], file="/proj/logged.h"),
+    class_symbol("Widget", file="/proj/widget.h"),
+    class_symbol("Button", ["Widget"], file="/proj/widget.h"),
+]
+
+
+class TestHierarchyDelta(unittest.TestCase):
+    def setUp(self):
+        self.store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=MagicMock(),
+        )
+        self.store.bulk_write_symbols(CLASSES, [], [])
+
+    def _reindex(self, file, symbols):
+        self.store.remove_file(file)
+        self.store.bulk_write_symbols(symbols, [], [])
+
+    def test_unchanged_reindex_is_not_a_change(self):
+        version = self.store.class_change_version()
+        self._reindex(
+            "/proj/widget.h", [class_symbol("Widget"), class_symbol("Button", ["Widget"])]
+        )
+        changes = self.store.get_class_changes_since(version)
+        self.assertEqual((changes.names, changes.base_names), (set(), set()))
+
+    def test_changed_bases_are_reported(self):
+        version = self.store.class_change_version()
+        self._reindex(
+            "/proj/widget.h", [class_symbol("Widget"), class_symbol("Button", ["app::Stream"])]
+        )
+        changes = self.store.get_class_changes_since(version)
+        self.assertEqual(changes.names, {"Button"})
+        self.assertEqual(changes.base_names, {"Widget", "Stream"})
+        self.store.clear_all_indexes()
+        self.assertIsNone(self.store.get_class_changes_since(version))
+
+    def test_memo_keeps_unrelated_entries(self):
+        memo = HierarchyMemo()
+
+        def hierarchy(name):
+            return get_class_hierarchy(
+                name, None, None, "both", self.store, self.store.index_lock, memo=memo
+            )
+
+        hierarchy("Stream")
+        hierarchy("Widget")
+        self._reindex(
+            "/proj/widget.h",
+            [class_symbol("Widget"), class_symbol("Button", ["Widget", "Extra"])],
+        )
+        with patch.object(
+            hierarchy_analyzer,
+            "_resolve_base_key",
+            wraps=hierarchy_analyzer._resolve_base_key,
+        ) as resolve:
+            stream = hierarchy("Stream")
+            self.assertEqual(resolve.call_count, 0)
+            widget = hierarchy("Widget")
+            self.assertGreater(resolve.call_count, 0)
+        self.assertEqual(
+            stream,
+            get_class_hierarchy("Stream", None, None, "both", self.store, self.store.index_lock),
+        )
+        self.assertEqual(
+            widget["classes"]["app::Button"]["base_classes"], ["app::Widget", "Extra"]
+        )
+
+    def _assert_update_matches_rebuild(self, closure, version):
+        changes = self.store.get_class_changes_since(version)
+        updated = closure.updated(changes, self.store, self.store.index_lock)
+        rebuilt = InheritanceClosure.build(self.store, self.store.index_lock)
+        self.assertEqual(updated.bases, rebuilt.bases)
+        self.assertEqual(dict(updated.derived), dict(rebuilt.derived))
+        self.assertEqual(updated.depth, rebuilt.depth)
+        self.assertEqual(updated.project_keys, rebuilt.project_keys)
+        for key in rebuilt.bases:
+            self.assertEqual(updated.descendant_count(key), rebuilt.descendant_count(key))
+            for sub in rebuilt.bases:
+                self.assertEqual(
+                    updated.is_derived_from(sub, key), rebuilt.is_derived_from(sub, key)
+                )
+        self.assertEqual(updated.stats(20, False), rebuilt.stats(20, False))
+        return updated
+
+    def test_closure_update_matches_rebuild(self):
+        closure = InheritanceClosure.build(self.store, self.store.index_lock)
+        logged = "/proj/logged.h"
+        edits = [
+            (
+                "/proj/widget.h",
+                [class_symbol("Widget", ["Input"]), class_symbol("Button", ["Widget"])],
+            ),
+            (
+                "/proj/logged.h",
+                [class_symbol("LoggedInput", ["Logged<app::Output>"], file=logged)],
+            ),
+            ("/proj/logged.h", []),
+            ("/proj/new.h", [class_symbol("Slider", ["app::Button"], file="/proj/new.h")]),
+        ]
+        for file, symbols in edits:
+            version = self.store.class_change_version()
+            self._reindex(file, symbols)
+            closure = self._assert_update_matches_rebuild(closure, version)
+        self.assertTrue(closure.is_derived_from("app::Button", "app::Stream"))
+        self.assertNotIn("app::LoggedInput", closure)
+        self.assertTrue(closure.is_derived_from("app::Slider", "app::Input"))
+
+    def test_closure_update_patches_affected_labels(self):
+        closure = InheritanceClosure.build(self.store, self.store.index_lock)
+        version = self.store.class_change_version()
+        self._reindex(
+            "/proj/widget.h", [class_symbol("Widget"), class_symbol("Button", ["Widget", "Input"])]
+        )
+        changes = self.store.get_class_changes_since(version)
+        with patch.object(InheritanceClosure, "_label", side_effect=AssertionError):
+            updated = closure.updated(changes, self.store, self.store.index_lock)
+        self.assertTrue(updated.is_derived_from("app::Button", "app::Stream"))
+        # Labels outside the ancestors of the changed edge are shared
+        self.assertIs(updated.intervals["app::IOStream"], closure.intervals["app::IOStream"])
+        # The previous closure is left as it was
+        self.assertFalse(closure.is_derived_from("app::Button", "app::Stream"))
+
+    def test_closure_reused_without_edge_changes(self):
+        closure = InheritanceClosure.build(self.store, self.store.index_lock)
+        version = self.store.class_change_version()
+        self._reindex(
+            "/proj/widget.h", [class_symbol("Widget"), class_symbol("Button", ["Widget"])]
+        )
+        changes = self.store.get_class_changes_since(version)
+        self.assertIs(closure.updated(changes, self.store, self.store.index_lock), closure)
+
+
+if __name__ == "__main__":
+    unittest.main()
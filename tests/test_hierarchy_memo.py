@@ -0,0 +1,66 @@
+"""
+Tests for the generation-stamped hierarchy memo (base-key resolutions and
+node data reused across get_class_hierarchy queries).
+"""
+
+import threading
+import unittest
+from unittest.mock import MagicMock, patch
+
+from clang_index_mcp._search import hierarchy_analyzer
+from clang_index_mcp._search.hierarchy_analyzer import HierarchyMemo, get_class_hierarchy
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+from tests.utils.test_helpers import class_symbol
+
+
+class TestHierarchyMemo(unittest.TestCase):
+    def setUp(self):
+        self.store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=MagicMock(),
+        )
+        widgets = [class_symbol(f"Widget{i}", ["QObject"], ns="ui") for i in range(20)]
+        self.store.bulk_write_symbols([class_symbol("QObject", ns="ui")] + widgets, [], [])
+        self.memo = HierarchyMemo()
+
+    def _hierarchy(self, name, memo=None, direction="both"):
+        return get_class_hierarchy(
+            name, None, None, direction, self.store, self.store.index_lock, memo=memo
+        )
+
+    def test_same_result_as_without_memo(self):
+        for name in ("QObject", "Widget3"):
+            self.assertEqual(self._hierarchy(name, self.memo), self._hierarchy(name))
+
+    def test_repeated_queries_reuse_resolutions(self):
+        with patch.object(
+            hierarchy_analyzer,
+            "_resolve_base_key",
+            wraps=hierarchy_analyzer._resolve_base_key,
+        ) as resolve:
+            self._hierarchy("QObject", self.memo, "down")
+            # "QObject" is resolved once for all 20 subclasses
+            self.assertEqual(resolve.call_count, 1)
+            self._hierarchy("Widget7", self.memo)
+            self.assertEqual(resolve.call_count, 1)
+
+    def test_index_changes_invalidate(self):
+        self._hierarchy("QObject", self.memo)
+        self.store.bulk_write_symbols([class_symbol("Dialog", ["ui::QObject"], ns="ui")], [], [])
+        classes = self._hierarchy("QObject", self.memo)["classes"]
+        self.assertIn("ui::Dialog", classes["ui::QObject"]["derived_classes"])
+        self.assertIn("ui::Dialog", classes)
+
+    def test_returned_nodes_are_private_copies(self):
+        first = self._hierarchy("Widget1", self.memo)["classes"]
+        first["ui::Widget1"]["base_classes"].append("Bogus")
+        first["ui::Widget1"]["kind"] = "mutated"
+        again = self._hierarchy("Widget1", self.memo)["classes"]["ui::Widget1"]
+        self.assertEqual(again["base_classes"], ["ui::QObject"])
+        self.assertEqual(again["kind"], "class")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,117 @@
+"""
+Tests for the transitive inheritance closure (interval-labeled is-a queries)
+and get_class_hierarchy_stats.
+"""
+
+import json
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+from clang_index_mcp._search import template_analyzer
+from clang_index_mcp._search.inheritance_closure import InheritanceClosure, get_derived_classes
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+from tests.utils.test_helpers import class_symbol
+
+
+# Diamond: Stream <- Input, Output <- IOStream <- FileStream; plus an
+# external base and inheritance through a template parameter.
+CLASSES = [
+    class_symbol("Stream"),
+    class_symbol("Input", ["Stream"]),
+    class_symbol("Output", ["app::Stream"]),
+    class_symbol("IOStream", ["Input", "Output"]),
+    class_symbol("FileStream", ["IOStream"]),
+    class_symbol("Error", ["std::exception"]),
+    class_symbol(
+        "Logged",
+        ["T"],
+        kind="class_template",
+        template_parameters=json.dumps([{"name": "T", "kind": "type"}]),
+    ),
+    class_symbol("LoggedInput", ["Logged<app::Input>"]),
+    class_symbol("Lonely"),
+]
+
+
+class TestInheritanceClosure(unittest.TestCase):
+    def setUp(self):
+        self.store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=MagicMock(),
+        )
+        self.store.bulk_write_symbols(CLASSES, [], [])
+        self.closure = InheritanceClosure.build(self.store, self.store.index_lock)
+
+    def test_is_derived_from(self):
+        derives = self.closure.is_derived_from
+        self.assertTrue(derives("app::FileStream", "app::Stream"))
+        self.assertTrue(derives("app::IOStream", "app::Output"))
+        self.assertTrue(derives("app::LoggedInput", "app::Stream"))
+        self.assertTrue(derives("app::LoggedInput", "app::Logged"))
+        self.assertTrue(derives("app::Error", "std::exception"))
+        self.assertFalse(derives("app::Stream", "app::FileStream"))
+        self.assertFalse(derives("app::Input", "app::Output"))
+        self.assertFalse(derives("app::Stream", "app::Stream"))
+        self.assertFalse(derives("app::Missing", "app::Stream"))
+
+    def test_subclasses(self):
+        self.assertEqual(self.closure.derived_classes("app::Stream"), ["app::Input", "app::Output"])
+        self.assertEqual(self.closure.descendant_count("app::Stream"), 5)
+        self.assertEqual(self.closure.derived_classes("app::Lonely"), [])
+        self.assertEqual(self.closure.descendant_count("app::Lonely"), 0)
+
+    def test_derived_classes_match_base_matching(self):
+        lock = self.store.index_lock
+        for name in ["Stream", "app::Input", "Logged", "std::exception", "Lonely", "Missing"]:
+            self.assertEqual(
+                get_derived_classes(name, False, self.closure, self.store, lock),
+                template_analyzer.get_derived_classes(name, False, self.store, lock),
+                name,
+            )
+
+    def test_matches_brute_force_reachability(self):
+        def reaches(key, base):
+            frontier, seen = list(self.closure.bases[key]), set()
+            while frontier:
+                current = frontier.pop()
+                if current == base:
+                    return True
+                if current not in seen:
+                    seen.add(current)
+                    frontier.extend(self.closure.bases[current])
+            return False
+
+        keys = list(self.closure.bases)
+        for key in keys:
+            for base in keys:
+                self.assertEqual(
+                    self.closure.is_derived_from(key, base), reaches(key, base), (key, base)
+                )
+
+    def test_stats(self):
+        stats = self.closure.stats(limit=2)
+        self.assertEqual(stats["total_classes"], len(CLASSES))
+        self.assertEqual(stats["max_depth"], 3)
+        self.assertEqual(stats["deepest"][0]["qualified_name"], "app::FileStream")
+        self.assertEqual(
+            stats["widest"][0],
+            {"qualified_name": "app::Stream", "direct_subclasses": 2, "total_subclasses": 5},
+        )
+        self.assertEqual(len(stats["widest"]), 2)
+
+        # External bases are only reported outside project scope
+        self.assertNotIn("std::exception", json.dumps(stats))
+        external = self.closure.stats(limit=20, project_only=False)
+        self.assertIn("std::exception", [w["qualified_name"] for w in external["widest"]])
+
+    def test_cycles_from_name_collisions_terminate(self):
+        closure = InheritanceClosure({"A": ["B"], "B": ["A"], "C": ["A"]}, {"A", "B", "C"})
+        self.assertTrue(closure.is_derived_from("C", "A"))
+        self.assertEqual(len(closure.order), 3)
+
+
+if __name__ == "__main__":
+    unittest.main()
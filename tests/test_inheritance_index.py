@@ -0,0 +1,115 @@
+"""
+Tests for the reverse inheritance index (base class name -> derived classes).
+
+SymbolIndexStore keeps the index in step with class_index, so
+get_derived_classes only checks classes that name the base (or one of its
+specializations) instead of every indexed class.
+"""
+
+import json
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+from clang_index_mcp._search.template_analyzer import get_derived_classes
+from clang_index_mcp._symbols.inheritance_index import InheritanceIndex, base_keys
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+from tests.utils.test_helpers import class_symbol
+
+
+def _store():
+    return SymbolIndexStore(
+        lock_provider=threading.RLock(),
+        alias_persistence=MagicMock(),
+        cache_manager=MagicMock(),
+        call_graph_port=MagicMock(),
+    )
+
+
+def _derived(store, name):
+    return sorted(
+        d["qualified_name"]
+        for d in get_derived_classes(name, False, store, store.index_lock)
+    )
+
+
+class TestBaseKeys(unittest.TestCase):
+    def test_keys_strip_namespaces_and_template_arguments(self):
+        info = class_symbol("W", ["ns::Container<std::vector<int>>", "Mixin<app::Sensor, Box>"])
+        self.assertEqual(base_keys(info), {"Container", "vector", "Mixin", "Sensor", "Box"})
+
+
+class TestInheritanceIndex(unittest.TestCase):
+    def setUp(self):
+        self.store = _store()
+        self.store.bulk_write_symbols(
+            [
+                class_symbol("Shape"),
+                class_symbol("Circle", ["app::Shape"]),
+                class_symbol("Square", ["Shape"], file="/proj/square.h"),
+                class_symbol("ShapeImpl"),
+                class_symbol("Blob", ["ShapeImpl"]),
+                class_symbol(
+                    "Container", kind="class_template", template_parameters='[{"name": "T"}]'
+                ),
+                class_symbol("IntBox", ["Container<int>"]),
+                class_symbol("Crtp", ["app::Container<app::Crtp>"]),
+                class_symbol(
+                    "Inherits",
+                    ["T"],
+                    kind="class_template",
+                    template_parameters=json.dumps([{"name": "T", "kind": "type"}]),
+                ),
+                class_symbol("Wrapped", ["Inherits<app::Shape>"], file="/proj/square.h"),
+            ],
+            [],
+            [],
+        )
+
+    def test_direct_and_qualified_bases(self):
+        # Prefix-only matches (ShapeImpl) are not derived classes of Shape
+        self.assertEqual(
+            _derived(self.store, "Shape"), ["app::Circle", "app::Square", "app::Wrapped"]
+        )
+        self.assertEqual(_derived(self.store, "app::ShapeImpl"), ["app::Blob"])
+        self.assertEqual(_derived(self.store, "Blob"), [])
+
+    def test_template_specializations_map_to_primary(self):
+        self.assertEqual(_derived(self.store, "Container"), ["app::Crtp", "app::IntBox"])
+
+    def test_removal_unlinks_derived_classes(self):
+        self.store.remove_file("/proj/square.h")
+        self.assertEqual(_derived(self.store, "Shape"), ["app::Circle"])
+        self.assertEqual(self.store.get_derived_class_candidates("Inherits"), [])
+
+    def test_replaced_bases_are_reindexed(self):
+        blob = self.store.get_classes_by_name("Blob")[0]
+        self.store.set_base_classes(blob, ["app::Shape"])
+        self.assertEqual(_derived(self.store, "ShapeImpl"), [])
+        self.assertIn("app::Blob", _derived(self.store, "Shape"))
+
+    def test_rebuilt_from_cache(self):
+        loaded = _store()
+        loaded.populate_indexes_from_cache({"class_index": dict(self.store.class_index)})
+        self.assertEqual(_derived(loaded, "Container"), ["app::Crtp", "app::IntBox"])
+        loaded.clear_all_indexes()
+        self.assertEqual(loaded.get_derived_class_candidates("Container"), [])
+
+    def test_unlink_one_of_many_derived_classes(self):
+        index = InheritanceIndex()
+        widgets = [class_symbol(f"W{i}", ["QObject"]) for i in range(5)]
+        anonymous = class_symbol("", ["QObject"])
+        anonymous.usr = ""
+        for info in [*widgets, anonymous]:
+            index.add(info)
+
+        index.remove(widgets[2])
+        index.remove(class_symbol("", ["QObject"]))  # equal, but not the indexed object
+        self.assertEqual(index.candidates("QObject"), [*widgets[:2], *widgets[3:], anonymous])
+        for info in [*widgets, anonymous]:
+            index.remove(info)
+        self.assertEqual((index.candidates("QObject"), index.key_count()), ([], 0))
+
+
+if __name__ == "__main__":
+    unittest.main()
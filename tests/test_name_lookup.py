@@ -0,0 +1,102 @@
+"""Tests for the name lookup structures behind smart fallback suggestions."""
+
+import threading
+import time
+from types import SimpleNamespace
+from unittest.mock import MagicMock
+
+from clang_index_mcp._search.name_lookup import NameLookup, edits1, longest_literal
+from clang_index_mcp._search.smart_fallback import SmartFallback
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+
+def _index(*names):
+    index = {}
+    for name in names:
+        index.setdefault(name, []).append(SimpleNamespace(name=name, qualified_name=name))
+    return index
+
+
+def _far_deadline():
+    return time.monotonic() + 60
+
+
+class TestEdits1:
+    def test_contains_each_edit_kind(self):
+        edits = edits1("abc")
+        assert {"ab", "bac", "abd", "abcd"} <= edits
+
+    def test_excludes_distance_two(self):
+        assert "c" not in edits1("abc")
+
+
+class TestLongestLiteral:
+    def test_plain_and_anchored(self):
+        assert longest_literal("Widget") == "Widget"
+        assert longest_literal("^Widget$") == "Widget"
+
+    def test_quantified_character_is_optional(self):
+        assert longest_literal(".*Handlers?") == "Handler"
+        assert longest_literal("I[A-Z].*Factory") == "Factory"
+
+    def test_alternation_and_qualified_runs(self):
+        assert longest_literal("Foo|Bar") == ""
+        assert longest_literal("app::ui::.*Win") == "Win"
+
+
+class TestNameLookup:
+    def setup_method(self):
+        self.lookup = NameLookup([_index("Widget", "widget", "Window"), _index("WidgetFactory")])
+
+    def test_exact_before_case_insensitive(self):
+        assert [s.name for s in self.lookup.symbols("Widget")] == ["Widget"]
+        assert sorted(s.name for s in self.lookup.symbols("WIDGET")) == ["Widget", "widget"]
+        assert self.lookup.has_name("window")
+        assert not self.lookup.has_name("Windows_")
+
+    def test_similar_names(self):
+        assert self.lookup.similar_names("Widgt", _far_deadline()) == ["Widget", "widget"]
+        assert self.lookup.similar_names("WidgetFctry", _far_deadline()) == ["WidgetFactory"]
+
+    def test_expired_deadline_stops_distance_two(self):
+        assert self.lookup.similar_names("WidgetFctry", time.monotonic() - 1) == []
+
+    def test_regex_candidates_pruned_by_literal(self):
+        names = {s.name for s in self.lookup.regex_candidates(".*Factory", _far_deadline())}
+        assert names == {"WidgetFactory"}
+
+    def test_update_follows_index_changes(self):
+        widgets, factories = _index("Widget", "widget", "Window"), _index("WidgetFactory")
+        lookup = NameLookup([widgets, factories])
+        del widgets["widget"]
+        widgets.update(_index("Gadget"))
+        lookup.update(["Gadget", "Missing"], ["widget", "WidgetFactory"])
+        assert sorted(s.name for s in lookup.symbols("WIDGET")) == ["Widget"]
+        assert lookup.has_name("gadget")
+        assert lookup.has_name("widgetfactory")
+        assert not lookup.has_name("missing")
+
+
+class TestStoreBackedLookup:
+    def test_lookup_caught_up_instead_of_rebuilt(self):
+        store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=MagicMock(),
+        )
+        widget = SymbolInfo(name="Widget", kind="class", file="/proj/w.h", line=1, column=1)
+        store.bulk_write_symbols([widget], [], [])
+        fallback = SmartFallback()
+        lookup = fallback._get_lookup("class", [store.class_index], store)
+
+        gadget = SymbolInfo(name="Gadget", kind="class", file="/proj/g.h", line=1, column=1)
+        store.add_symbol_to_indexes(gadget)
+        store.remove_file("/proj/w.h")
+        assert fallback._get_lookup("class", [store.class_index], store) is lookup
+        assert lookup.has_name("gadget")
+        assert not lookup.has_name("widget")
+
+        store.clear_all_indexes()
+        assert fallback._get_lookup("class", [store.class_index], store) is not lookup
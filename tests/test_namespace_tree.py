@@ -0,0 +1,164 @@
+"""
+Tests for the namespace tree (NamespaceTree) and namespace listing.
+
+Namespace-filtered searches answered from the tree must return exactly what
+a full scan with matches_namespace returns, in index order.
+"""
+
+import os
+import sys
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+
+from clang_index_mcp._search.search_criteria import SearchCriteria
+from clang_index_mcp._search.search_engine import SearchEngine
+from clang_index_mcp._search.symbol_filters import matches_namespace
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.namespace_tree import NamespaceTree
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+NAMESPACES = ["", "app", "app::ui", "app::ui::detail", "lib::ui", "std", "app::net"]
+
+
+def _symbol(i, kind):
+    namespace = NAMESPACES[i % len(NAMESPACES)]
+    name = f"{'Class' if kind == 'class' else 'func'}{i}"
+    return SymbolInfo(
+        name=name,
+        kind=kind,
+        file=f"/proj/src/file{i % 5}.cpp",
+        line=i + 1,
+        column=1,
+        qualified_name=f"{namespace}::{name}" if namespace else name,
+        namespace=namespace,
+        is_project=namespace != "std",
+        usr=f"c:@{kind}{i}",
+    )
+
+
+def _make_store(count=140):
+    store = SymbolIndexStore(
+        lock_provider=threading.RLock(),
+        alias_persistence=MagicMock(),
+        cache_manager=MagicMock(),
+        call_graph_port=MagicMock(),
+    )
+    symbols = [_symbol(i, "class") for i in range(count)]
+    symbols += [_symbol(i, "function") for i in range(count)]
+    store.bulk_write_symbols(symbols, [], [])
+    return store
+
+
+class TestNamespaceTree(unittest.TestCase):
+    FILTERS = ["", "app", "ui", "app::ui", "detail", "ui::detail", "net", "missing", "pp"]
+
+    def setUp(self):
+        self.store = _make_store()
+        self.tree = NamespaceTree(self.store.function_index)
+
+    def test_symbols_in_matches_namespace_filter(self):
+        all_functions = [i for infos in self.store.function_index.values() for i in infos]
+        for namespace in self.FILTERS:
+            with self.subTest(namespace=namespace):
+                expected = [i for i in all_functions if matches_namespace(i.namespace, namespace)]
+                self.assertEqual(self.tree.symbols_in(namespace), expected)
+
+    def test_namespace_counts(self):
+        counts = self.tree.namespace_counts()
+        self.assertEqual(sum(counts.values()), 140)
+        self.assertNotIn("std", self.tree.namespace_counts(project_only=True))
+
+    def test_store_keeps_trees_in_step(self):
+        class_tree, function_tree = self.store.get_namespace_trees()
+        self.store.remove_file("/proj/src/file2.cpp")
+        self.store.bulk_write_symbols([_symbol(500, "function"), _symbol(501, "class")], [], [])
+        self.store.remove_symbol_from_indexes(self.store.function_index["func3"][0])
+        self.store.add_symbol_to_indexes(_symbol(3, "function"))
+        self.assertEqual(self.store.get_namespace_trees(), (class_tree, function_tree))
+
+        for tree, index in (
+            (class_tree, self.store.class_index),
+            (function_tree, self.store.function_index),
+        ):
+            rebuilt = NamespaceTree(index)
+            for namespace in self.FILTERS:
+                with self.subTest(namespace=namespace):
+                    self.assertEqual(tree.symbols_in(namespace), rebuilt.symbols_in(namespace))
+            self.assertEqual(tree.namespace_counts(), rebuilt.namespace_counts())
+
+        self.store.clear_all_indexes()
+        self.assertEqual(function_tree.symbols_in("app"), [])
+        self.assertEqual(function_tree.namespace_counts(), {})
+
+    def test_journal_and_scan_order(self):
+        _, tree = self.store.get_namespace_trees()
+        version = tree.version
+        removed = self.store.function_index["func3"][0]
+        self.store.remove_symbol_from_indexes(removed)
+        added = _symbol(500, "function")
+        self.store.add_symbol_to_indexes(added)
+        self.assertEqual(tree.changes_since(version), ([added], [removed]))
+        self.assertIsNone(tree.scan_order(removed))
+
+        in_order = [info for infos in self.store.function_index.values() for info in infos]
+        self.assertEqual(sorted(reversed(in_order), key=tree.scan_order), in_order)
+        self.store.clear_all_indexes()
+        self.assertIsNone(tree.changes_since(version))
+
+
+class TestNamespaceFilteredSearch(unittest.TestCase):
+    def setUp(self):
+        self.store = _make_store()
+        self.engine = SearchEngine(symbol_store=self.store)
+        self.scan_engine = SearchEngine(
+            class_index=self.store.class_index,
+            function_index=self.store.function_index,
+            file_index=self.store.file_index,
+            usr_index=self.store.usr_index,
+            index_lock=self.store.index_lock,
+        )
+
+    def test_results_match_full_scan(self):
+        for namespace in ("", "ui", "app::ui", "std"):
+            criteria = SearchCriteria(pattern="", project_only=False, namespace=namespace)
+            with self.subTest(namespace=namespace):
+                self.assertEqual(
+                    self.engine.search_classes(criteria), self.scan_engine.search_classes(criteria)
+                )
+                self.assertEqual(
+                    self.engine.search_functions(criteria),
+                    self.scan_engine.search_functions(criteria),
+                )
+
+
+class TestListNamespaces(unittest.TestCase):
+    def test_direct_and_nested_counts(self):
+        store = _make_store(count=14)
+        by_name = {n["namespace"]: n for n in store.list_namespaces()}
+        self.assertNotIn("std", by_name)
+        self.assertEqual(by_name["app::ui"]["classes"], 2)
+        self.assertEqual(by_name["app::ui"]["functions"], 2)
+        self.assertEqual(by_name["app::ui"]["total_symbols"], 8)
+        self.assertEqual(by_name["lib"]["total_symbols"], 4)
+        self.assertEqual(by_name["lib"]["classes"], 0)
+
+    def test_functions_count_only_function_kinds(self):
+        store = _make_store(count=14)
+        variable = _symbol(600, "variable")
+        variable.namespace, variable.qualified_name = "app::ui", "app::ui::func600"
+        store.bulk_write_symbols([variable], [], [])
+        by_name = {n["namespace"]: n for n in store.list_namespaces()}
+        self.assertEqual(by_name["app::ui"]["functions"], 2)
+        self.assertEqual(by_name["app::ui"]["total_symbols"], 8)
+
+    def test_parent_filter(self):
+        store = _make_store(count=14)
+        names = [n["namespace"] for n in store.list_namespaces(project_only=False, parent="app")]
+        self.assertEqual(names, ["app", "app::net", "app::ui", "app::ui::detail"])
+
+
+if __name__ == "__main__":
+    unittest.main()
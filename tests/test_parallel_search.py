@@ -0,0 +1,129 @@
+"""
+Tests for sharded parallel function search (ParallelFunctionSearch).
+
+Parallel verification must return exactly what a serial scan of
+function_index returns, in the same order, and must follow index changes.
+"""
+
+import os
+import sys
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+
+from clang_index_mcp._search.parallel_search import ParallelFunctionSearch, shard_of
+from clang_index_mcp._search.search_criteria import SearchCriteria
+from clang_index_mcp._search.search_engine import SearchEngine
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+
+def _make_store(function_count):
+    """Build a SymbolIndexStore with generated functions."""
+    symbols = []
+    for i in range(function_count):
+        name = f"func{i % 97}"
+        info = SymbolInfo(
+            name=name,
+            kind="method" if i % 3 else "function",
+            file=f"/proj/src/file{i % 13}.cpp",
+            line=i + 1,
+            column=1,
+            qualified_name=f"ns{i % 5}::{name}",
+            namespace=f"ns{i % 5}",
+            signature=f"{'int' if i % 2 else 'void'} {name}(const Widget{i % 7} &w)",
+            is_project=i % 11 != 0,
+            parent_class="Handler" if i % 3 else "",
+            usr=f"c:@F@{name}#{i}",
+        )
+        symbols.append(info)
+    symbols.append(
+        SymbolInfo(name="Var", kind="variable", file="/proj/src/v.cpp", line=1, column=1)
+    )
+    store = SymbolIndexStore(
+        lock_provider=threading.RLock(),
+        alias_persistence=MagicMock(),
+        cache_manager=MagicMock(),
+        call_graph_port=MagicMock(),
+    )
+    store.bulk_write_symbols(symbols, [], [])
+    return store
+
+
+class TestShardOf(unittest.TestCase):
+    def test_stable_and_in_range(self):
+        for name in ("foo", "Bar::baz", "operator<<", "x"):
+            shard = shard_of(name, 8)
+            self.assertEqual(shard, shard_of(name, 8))
+            self.assertTrue(0 <= shard < 8)
+
+
+class TestParallelFunctionSearch(unittest.TestCase):
+    CRITERIA = [
+        SearchCriteria(pattern="", signature_pattern="widget3", project_only=False),
+        SearchCriteria(pattern="func1.*", project_only=True),
+        SearchCriteria(pattern="ns2::func4", project_only=False),
+        SearchCriteria(pattern=".*", namespace="ns3", class_name="Handler"),
+        SearchCriteria(pattern="nomatch"),
+    ]
+
+    def setUp(self):
+        self.store = _make_store(2000)
+        self.serial = SearchEngine(symbol_store=self.store)
+
+    def _parallel_engine(self, mode):
+        search = ParallelFunctionSearch(workers=3, min_candidates=0)
+        search.mode = mode
+        self.addCleanup(search.close)
+        return SearchEngine(symbol_store=self.store, parallel_search=search)
+
+    def _assert_same_results(self, engine):
+        for criteria in self.CRITERIA:
+            with self.subTest(criteria=criteria):
+                self.assertEqual(
+                    engine.search_functions(criteria), self.serial.search_functions(criteria)
+                )
+
+    def test_thread_mode_matches_serial_scan(self):
+        self._assert_same_results(self._parallel_engine("thread"))
+
+    def test_process_mode_matches_serial_scan(self):
+        self._assert_same_results(self._parallel_engine("process"))
+
+    def _assert_follows_store_changes(self, mode):
+        engine = self._parallel_engine(mode)
+        criteria = SearchCriteria(pattern="brandNew", project_only=False)
+        self.assertEqual(engine.search_functions(criteria), [])
+
+        info = SymbolInfo(name="brandNew", kind="function", file="/proj/n.cpp", line=1, column=1)
+        self.store.add_symbol_to_indexes(info)
+        self.assertEqual(len(engine.search_functions(criteria)), 1)
+        self.store.remove_symbol_from_indexes(info)
+        self.assertEqual(engine.search_functions(criteria), [])
+
+        reindexed = self.store.get_symbols_in_file("/proj/src/file4.cpp")
+        self.store.remove_file("/proj/src/file4.cpp")
+        self.store.bulk_write_symbols(list(reindexed), [], [])
+        self._assert_same_results(engine)
+
+    def test_thread_mode_follows_store_changes(self):
+        self._assert_follows_store_changes("thread")
+
+    def test_process_mode_follows_store_changes(self):
+        self._assert_follows_store_changes("process")
+
+    def test_disabled_or_small_index_falls_back_to_serial(self):
+        args = ("", "unqualified", False, None, None, None)
+        disabled = ParallelFunctionSearch(workers=1, min_candidates=0)
+        self.assertIsNone(disabled.search(self.store, args))
+
+        too_small = ParallelFunctionSearch(workers=4, min_candidates=10**6)
+        too_small.mode = "thread"
+        self.addCleanup(too_small.close)
+        self.assertIsNone(too_small.search(self.store, args))
+
+
+if __name__ == "__main__":
+    unittest.main()
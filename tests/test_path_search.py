@@ -0,0 +1,156 @@
+"""
+Tests for bounded call path search (bidirectional BFS and Yen's k shortest paths).
+"""
+
+import itertools
+import random
+import unittest
+from collections import defaultdict, deque
+from unittest.mock import MagicMock
+
+from clang_index_mcp._search.call_graph import CallGraphAnalyzer
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._search.path_search import (
+    SearchBudget,
+    find_call_paths,
+    k_shortest_paths,
+    shortest_path,
+)
+
+
+class Graph:
+    def __init__(self, edges):
+        self.out = defaultdict(list)
+        self.inc = defaultdict(list)
+        for a, b in edges:
+            self.out[a].append(b)
+            self.inc[b].append(a)
+
+    def callees(self, node):
+        return self.out[node]
+
+    def callers(self, node):
+        return self.inc[node]
+
+    def distance(self, source, target):
+        """Reference single-direction BFS distance."""
+        seen = {source: 0}
+        queue = deque([source])
+        while queue:
+            node = queue.popleft()
+            if node == target:
+                return seen[node]
+            for nxt in self.out[node]:
+                if nxt not in seen:
+                    seen[nxt] = seen[node] + 1
+                    queue.append(nxt)
+        return None
+
+    def simple_paths(self, source, target, max_edges):
+        """Reference enumeration of all simple paths."""
+        paths = []
+        stack = [[source]]
+        while stack:
+            path = stack.pop()
+            if path[-1] == target:
+                paths.append(path)
+                continue
+            if len(path) - 1 < max_edges:
+                stack.extend(path + [n] for n in self.out[path[-1]] if n not in path)
+        return paths
+
+
+def _budget():
+    return SearchBudget(max_nodes=1_000_000, timeout_ms=60_000)
+
+
+def _random_graph(seed, nodes=60, edges=150):
+    rng = random.Random(seed)
+    return Graph({(rng.randrange(nodes), rng.randrange(nodes)) for _ in range(edges)})
+
+
+class TestShortestPath(unittest.TestCase):
+    def test_matches_reference_distance(self):
+        for seed in range(5):
+            graph = _random_graph(seed)
+            for source, target in itertools.product(range(0, 60, 7), range(3, 60, 11)):
+                with self.subTest(seed=seed, source=source, target=target):
+                    path = shortest_path(
+                        source, target, graph.callees, graph.callers, 50, _budget()
+                    )
+                    expected = graph.distance(source, target)
+                    if expected is None:
+                        self.assertIsNone(path)
+                        continue
+                    self.assertEqual(len(path) - 1, expected)
+                    self.assertEqual((path[0], path[-1]), (source, target))
+                    for a, b in zip(path, path[1:]):
+                        self.assertIn(b, graph.callees(a))
+
+    def test_max_edges(self):
+        graph = Graph([("a", "b"), ("b", "c"), ("c", "d")])
+        self.assertIsNone(shortest_path("a", "d", graph.callees, graph.callers, 2, _budget()))
+        self.assertEqual(
+            shortest_path("a", "d", graph.callees, graph.callers, 3, _budget()),
+            ["a", "b", "c", "d"],
+        )
+
+    def test_budget_stops_search(self):
+        chain = Graph([(i, i + 1) for i in range(1000)])
+        budget = SearchBudget(max_nodes=10, timeout_ms=60_000)
+        self.assertIsNone(shortest_path(0, 1000, chain.callees, chain.callers, 2000, budget))
+        self.assertTrue(budget.exhausted)
+
+
+class TestKShortestPaths(unittest.TestCase):
+    def test_matches_enumeration(self):
+        for seed in range(4):
+            graph = _random_graph(seed, nodes=25, edges=70)
+            for source, target in [(0, 5), (1, 9), (3, 24)]:
+                with self.subTest(seed=seed, source=source, target=target):
+                    paths = k_shortest_paths(
+                        source, target, graph.callees, graph.callers, 6, 8, _budget()
+                    )
+                    reference = sorted(len(p) for p in graph.simple_paths(source, target, 8))
+                    self.assertEqual([len(p) for p in paths], reference[:6])
+                    self.assertEqual(len({tuple(p) for p in paths}), len(paths))
+                    for path in paths:
+                        self.assertEqual(len(set(path)), len(path))
+
+
+class TestFindCallPaths(unittest.TestCase):
+    def test_multiple_sources_and_targets(self):
+        graph = Graph([("a", "x"), ("x", "t1"), ("b", "t2"), ("t2", "t1")])
+        paths = find_call_paths(
+            {"a", "b"}, {"t1", "t2"}, graph.callees, graph.callers, 5, 10, _budget()
+        )
+        self.assertEqual(paths[0], ["b", "t2"])
+        self.assertCountEqual(paths, [["b", "t2"], ["a", "x", "t1"], ["b", "t2", "t1"]])
+
+    def test_source_is_target(self):
+        graph = Graph([("a", "b")])
+        paths = find_call_paths({"a"}, {"a"}, graph.callees, graph.callers, 0, 10, _budget())
+        self.assertEqual(paths, [["a"]])
+
+    def test_analyzer_get_call_paths(self):
+        analyzer = CallGraphAnalyzer()
+        for caller, callee, line in [("m", "p", 1), ("p", "l", 2), ("m", "r", 3), ("r", "l", 4)]:
+            analyzer.add_call(caller, callee, "a.cpp", line)
+        self.assertEqual(
+            sorted(analyzer.get_call_paths("m", "l")), [["m", "p", "l"], ["m", "r", "l"]]
+        )
+        self.assertEqual(analyzer.get_call_paths("m", "l", max_depth=1), [])
+        self.assertEqual(analyzer.get_call_paths("m", "m"), [["m"]])
+
+    def test_analyzer_uses_configured_budget(self):
+        analyzer = CallGraphAnalyzer(path_node_budget=1)
+        analyzer.add_call("m", "p", "a.cpp", 1)
+        analyzer.add_call("p", "l", "a.cpp", 2)
+        self.assertEqual(analyzer.get_call_paths("m", "l"), [])
+        service = CallGraphService(MagicMock(), path_node_budget=7, path_timeout_ms=30.0)
+        analyzer = service.call_graph_analyzer
+        self.assertEqual((analyzer.path_node_budget, analyzer.path_timeout_ms), (7, 30.0))
+
+
+if __name__ == "__main__":
+    unittest.main()
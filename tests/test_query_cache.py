@@ -0,0 +1,144 @@
+"""
+Tests for the query result cache (QueryResultCache) and its use in QueryEngine.
+"""
+
+import os
+import sys
+import unittest
+from types import SimpleNamespace
+from unittest.mock import MagicMock
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+
+from clang_index_mcp._search.query_cache import QueryResultCache
+from clang_index_mcp._search.query_engine import QueryEngine
+from clang_index_mcp._search.smart_fallback import FallbackResult
+
+
+class TestQueryResultCache(unittest.TestCase):
+    def setUp(self):
+        self.cache = QueryResultCache(max_bytes=1024 * 1024)
+        self.calls = 0
+
+    def _compute(self, value):
+        def compute():
+            self.calls += 1
+            return value
+
+        return compute
+
+    def test_repeated_query_hits(self):
+        first = self.cache.get_or_compute("op", ("a", True), 1, self._compute({"x": [1]}))
+        second = self.cache.get_or_compute("op", ("a", True), 1, self._compute({"x": [2]}))
+        self.assertEqual(first, {"x": [1]})
+        self.assertEqual(second, {"x": [1]})
+        self.assertEqual(self.calls, 1)
+        stats = self.cache.get_stats()
+        self.assertEqual((stats["hits"], stats["misses"]), (1, 1))
+        self.assertEqual(stats["hit_rate"], 0.5)
+
+    def test_hits_return_independent_copies(self):
+        self.cache.get_or_compute("op", (), 1, self._compute({"_internal": True, "items": [1]}))
+        hit = self.cache.get_or_compute("op", (), 1, self._compute(None))
+        hit.pop("_internal")
+        hit["items"].append(2)
+        again = self.cache.get_or_compute("op", (), 1, self._compute(None))
+        self.assertEqual(again, {"_internal": True, "items": [1]})
+
+    def test_tuple_results_survive(self):
+        self.cache.get_or_compute("op", (), 1, self._compute(([{"a": 1}], 5)))
+        hit = self.cache.get_or_compute("op", (), 1, self._compute(None))
+        self.assertEqual(hit, ([{"a": 1}], 5))
+
+    def test_arguments_are_normalized(self):
+        self.cache.get_or_compute("op", ("p", ["class", "struct"]), 1, self._compute("r"))
+        self.cache.get_or_compute("op", ("p", ("class", "struct")), 1, self._compute("other"))
+        self.assertEqual(self.calls, 1)
+
+    def test_operation_and_args_distinguish_entries(self):
+        self.cache.get_or_compute("op1", ("p",), 1, self._compute("a"))
+        self.cache.get_or_compute("op2", ("p",), 1, self._compute("b"))
+        self.cache.get_or_compute("op1", ("q",), 1, self._compute("c"))
+        self.assertEqual(self.calls, 3)
+
+    def test_generation_change_invalidates(self):
+        self.cache.get_or_compute("op", (), 1, self._compute("old"))
+        result = self.cache.get_or_compute("op", (), 2, self._compute("new"))
+        self.assertEqual(result, "new")
+        self.assertEqual(self.cache.get_stats()["entries"], 1)
+
+    def test_generations_are_kept_per_operation(self):
+        self.cache.get_or_compute("symbols", (), 1, self._compute("a"))
+        self.cache.get_or_compute("calls", (), (1, 0), self._compute("b"))
+        self.cache.get_or_compute("calls", (), (1, 1), self._compute("c"))
+        self.assertEqual(self.cache.get_or_compute("symbols", (), 1, self._compute("x")), "a")
+        self.assertEqual(self.calls, 3)
+        self.assertEqual(self.cache.get_stats()["entries"], 2)
+
+    def test_byte_bound_evicts_least_recently_used(self):
+        cache = QueryResultCache(max_bytes=8 * 200)
+        payload = "x" * 150
+        for i in range(12):
+            cache.get_or_compute("op", (i,), 1, self._compute(payload))
+        stats = cache.get_stats()
+        self.assertLessEqual(stats["size_bytes"], stats["max_bytes"])
+        self.assertGreater(stats["evictions"], 0)
+        calls = self.calls
+        cache.get_or_compute("op", (0,), 1, self._compute(payload))
+        self.assertEqual(self.calls, calls + 1)
+
+    def test_oversized_results_are_not_cached(self):
+        cache = QueryResultCache(max_bytes=800)
+        cache.get_or_compute("op", (), 1, self._compute("y" * 500))
+        self.assertEqual(cache.get_stats()["entries"], 0)
+
+    def test_disabled_cache_always_computes(self):
+        cache = QueryResultCache(max_bytes=0)
+        cache.get_or_compute("op", (), 1, self._compute("a"))
+        cache.get_or_compute("op", (), 1, self._compute("a"))
+        self.assertEqual(self.calls, 2)
+        self.assertFalse(cache.get_stats()["enabled"])
+
+
+class TestQueryEngineCaching(unittest.TestCase):
+    def setUp(self):
+        self.store = SimpleNamespace(generation=1)
+        self.search_engine = MagicMock()
+        self.smart_fallback = MagicMock()
+        self.engine = QueryEngine(
+            symbol_store=self.store,
+            cache_manager=MagicMock(),
+            concurrency=MagicMock(),
+            compilation_env=MagicMock(),
+            call_graph_service=MagicMock(),
+            project_root=MagicMock(),
+            search_engine=self.search_engine,
+            smart_fallback=self.smart_fallback,
+            query_cache=QueryResultCache(max_bytes=1024 * 1024),
+        )
+
+    def test_search_functions_cached_until_generation_changes(self):
+        self.search_engine.search_functions.return_value = [{"qualified_name": "foo"}]
+        self.engine.search_functions("foo")
+        self.engine.search_functions("foo", project_only=True)
+        self.assertEqual(self.search_engine.search_functions.call_count, 1)
+
+        self.store.generation += 1
+        self.engine.search_functions("foo")
+        self.assertEqual(self.search_engine.search_functions.call_count, 2)
+
+    def test_fallback_is_restored_on_hit(self):
+        self.search_engine.search_classes.return_value = []
+        fallback = FallbackResult(reason="regex_hint", searched_for="Wdget", hint="typo?")
+        self.smart_fallback.analyze_empty_result.return_value = fallback
+
+        self.engine.search_classes("Wdget")
+        self.assertEqual(self.engine.pop_last_fallback(), fallback)
+
+        self.engine.search_classes("Wdget")
+        self.assertEqual(self.engine.pop_last_fallback(), fallback)
+        self.assertEqual(self.smart_fallback.analyze_empty_result.call_count, 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
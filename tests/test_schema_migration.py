@@ -49,7 +49,7 @@ class TestSchemaMigration(unittest.TestCase):
 
         # Verify migration applied
         self.assertFalse(migration.needs_migration())
-        self.assertEqual(migration.get_current_version(), 3)
+        self.assertEqual(migration.get_current_version(), 8)
 
         # Verify file_dependencies table exists
         cursor = conn.execute("""
@@ -100,13 +100,13 @@ class TestSchemaMigration(unittest.TestCase):
         # First migration
         migration = SchemaMigration(conn)
         migration.migrate()
-        self.assertEqual(migration.get_current_version(), 3)
+        self.assertEqual(migration.get_current_version(), 8)
 
         # Second migration (should be no-op)
         migration2 = SchemaMigration(conn)
         self.assertFalse(migration2.needs_migration())
         migration2.migrate()  # Should not raise error
-        self.assertEqual(migration2.get_current_version(), 3)
+        self.assertEqual(migration2.get_current_version(), 8)
 
         conn.close()
 
@@ -216,12 +216,15 @@ class TestSchemaMigration(unittest.TestCase):
         # Get history
         history = migration.get_migration_history()
 
-        # Should have 3 entries: version 1 (initial), version 2 (file_dependencies), and version 3 (failure tracking)
-        self.assertEqual(len(history), 3)
+        # Should have 8 entries: version 1 (initial), version 2 (file_dependencies),
+        # version 3 (failure tracking), version 4 (integer-keyed call_sites),
+        # version 5 (call_degrees), version 6 (call_site_template_types),
+        # version 7 (method_overrides) and version 8 (idx_call_sites_callee_line)
+        self.assertEqual(len(history), 8)
 
         # Check versions
         versions = [h[0] for h in history]
-        self.assertEqual(versions, [1, 2, 3])
+        self.assertEqual(versions, [1, 2, 3, 4, 5, 6, 7, 8])
 
         # Check that migration 2 has description
         migration_2 = [h for h in history if h[0] == 2][0]
@@ -229,6 +232,84 @@ class TestSchemaMigration(unittest.TestCase):
 
         conn.close()
 
+    def test_call_sites_usr_ids_migration(self):
+        """Test migration 004 moves call_sites USRs into usr_ids."""
+        conn = sqlite3.connect(str(self.db_path))
+        conn.execute("""
+            CREATE TABLE schema_version (
+                version INTEGER PRIMARY KEY,
+                applied_at REAL NOT NULL,
+                description TEXT NOT NULL
+            )
+        """)
+        conn.executemany(
+            "INSERT INTO schema_version VALUES (?, julianday('now'), 'old')", [(1,), (2,), (3,)]
+        )
+        conn.execute("""
+            CREATE TABLE call_sites (
+                id INTEGER PRIMARY KEY AUTOINCREMENT,
+                caller_usr TEXT NOT NULL,
+                callee_usr TEXT NOT NULL,
+                file TEXT NOT NULL,
+                line INTEGER NOT NULL,
+                column INTEGER,
+                display_name TEXT,
+                template_project_types TEXT,
+                created_at REAL NOT NULL
+            )
+        """)
+        conn.executemany(
+            "INSERT INTO call_sites (caller_usr, callee_usr, file, line, created_at) "
+            "VALUES (?, ?, 'a.cpp', ?, 0)",
+            [("c:@F@main", "c:@F@run", 3), ("c:@F@main", "c:@F@stop", 4)],
+        )
+        conn.execute(
+            "INSERT INTO call_sites (caller_usr, callee_usr, file, line, "
+            "display_name, template_project_types, created_at) VALUES "
+            "('c:@F@main', 'c:@N@std@FT@make_shared', 'a.cpp', 5, "
+            """'std::make_shared<app::Box<int>>', '["app::Box<int>"]', 0)"""
+        )
+        conn.commit()
+
+        SchemaMigration(conn).migrate()
+
+        self.assertEqual(conn.execute("SELECT COUNT(*) FROM usr_ids").fetchone()[0], 4)
+        rows = conn.execute("""
+            SELECT caller.usr, callee.usr, cs.line
+            FROM call_sites cs
+            JOIN usr_ids caller ON caller.id = cs.caller_id
+            JOIN usr_ids callee ON callee.id = cs.callee_id
+            ORDER BY cs.line
+        """).fetchall()
+        self.assertEqual(rows[:2], [("c:@F@main", "c:@F@run", 3), ("c:@F@main", "c:@F@stop", 4)])
+
+        # Migration 005 counts the migrated call sites into call_degrees
+        degrees = conn.execute("""
+            SELECT u.usr, d.in_degree, d.out_degree
+            FROM call_degrees d JOIN usr_ids u ON u.id = d.usr_id
+            ORDER BY u.usr
+        """).fetchall()
+        self.assertEqual(
+            degrees,
+            [
+                ("c:@F@main", 0, 3),
+                ("c:@F@run", 1, 0),
+                ("c:@F@stop", 1, 0),
+                ("c:@N@std@FT@make_shared", 1, 0),
+            ],
+        )
+
+        # Migration 006 indexes the template-mediated call site by its project type
+        linked = conn.execute("""
+            SELECT t.name, t.short_name, cs.line
+            FROM call_site_template_types ct
+            JOIN template_type_names t ON t.id = ct.type_id
+            JOIN call_sites cs ON cs.id = ct.call_site_id
+        """).fetchall()
+        self.assertEqual(linked, [("app::Box<int>", "Box", 5)])
+
+        conn.close()
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,174 @@
+"""
+Tests for the signature_pattern token index (SignatureTokenIndex).
+
+Index-backed signature searches must return exactly what a full scan of
+function_index returns, in the same order, and type aliases named in the
+pattern must expand to their canonical spelling (and back).
+"""
+
+import os
+import sys
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), ".."))
+
+from clang_index_mcp._search.search_criteria import SearchCriteria
+from clang_index_mcp._search.search_engine import SearchEngine
+from clang_index_mcp._search.signature_index import (
+    SignatureTokenIndex,
+    expand_signature_pattern,
+    signature_tokens,
+)
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+TYPES = ["int", "const Widget &", "std::string", "ErrorCallback", "Widget *"]
+
+
+def _function(i, name=None, signature=None):
+    name = name or f"handle{i % 41}"
+    return SymbolInfo(
+        name=name,
+        kind="method" if i % 2 else "function",
+        file=f"/proj/src/file{i % 7}.cpp",
+        line=i + 1,
+        column=1,
+        qualified_name=f"app::{name}",
+        namespace="app",
+        signature=signature or f"void {name}({TYPES[i % len(TYPES)]} arg{i % 3})",
+        parent_class="Handler" if i % 2 else "",
+        access="public" if i % 2 else "",
+        is_project=True,
+    )
+
+
+def _make_store(function_count):
+    store = SymbolIndexStore(
+        lock_provider=threading.RLock(),
+        alias_persistence=MagicMock(),
+        cache_manager=MagicMock(),
+        call_graph_port=MagicMock(),
+    )
+    store.bulk_write_symbols([_function(i) for i in range(function_count)], [], [])
+    return store
+
+
+class FakeAliasCache:
+    """Alias table stand-in: ErrorCallback = std::function<void(int)>."""
+
+    ALIASES = {"ErrorCallback": "std::function<void(int)>"}
+
+    def get_canonical_for_alias(self, alias_name):
+        return self.ALIASES.get(alias_name)
+
+    def get_aliases_for_canonical(self, canonical_type):
+        return [a for a, c in self.ALIASES.items() if c == canonical_type]
+
+
+class TestSignatureTokens(unittest.TestCase):
+    def test_tokens_are_lowercase_identifiers(self):
+        self.assertEqual(
+            signature_tokens("void app::Foo(const Widget &w)"),
+            {"void", "app", "foo", "const", "widget", "w"},
+        )
+
+
+class TestSignatureTokenIndex(unittest.TestCase):
+    PATTERNS = [
+        "const Widget &",
+        "widget",
+        "idge",
+        "(std::str",
+        "ring arg1)",
+        "Widget *",
+        "public void",
+        "Handler::handle3(",
+        "nomatch",
+        "&",
+    ]
+
+    def setUp(self):
+        self.store = _make_store(600)
+        self.engine = SearchEngine(symbol_store=self.store)
+
+    def _scan(self, signature_pattern):
+        """Reference result: every function whose prototype contains the pattern."""
+        engine = SearchEngine(
+            class_index=self.store.class_index,
+            function_index=self.store.function_index,
+            file_index=self.store.file_index,
+            usr_index=self.store.usr_index,
+            index_lock=self.store.index_lock,
+        )
+        return engine.search_functions(
+            SearchCriteria(pattern="", signature_pattern=signature_pattern, project_only=False)
+        )
+
+    def test_indexed_search_matches_full_scan(self):
+        for signature_pattern in self.PATTERNS:
+            with self.subTest(signature_pattern=signature_pattern):
+                criteria = SearchCriteria(
+                    pattern="", signature_pattern=signature_pattern, project_only=False
+                )
+                self.assertEqual(
+                    self.engine.search_functions(criteria), self._scan(signature_pattern)
+                )
+
+    def test_candidates_narrow_the_scan(self):
+        index = SignatureTokenIndex()
+        candidates = index.candidates(self.store, "handle3(")
+        self.assertIsNotNone(candidates)
+        self.assertLess(len(candidates), 600 // 10)
+        self.assertIsNone(index.candidates(self.store, "&"))
+
+    def test_store_changes_are_caught_up(self):
+        criteria = SearchCriteria(pattern="", signature_pattern="Gadget &", project_only=False)
+        self.assertEqual(self.engine.search_functions(criteria), [])
+
+        info = _function(0, name="addGadget", signature="void addGadget(Gadget &g)")
+        self.store.add_symbol_to_indexes(info)
+        self.assertEqual(len(self.engine.search_functions(criteria)), 1)
+        self.store.remove_symbol_from_indexes(info)
+        self.assertEqual(self.engine.search_functions(criteria), [])
+
+        # Re-index a file: its functions move behind the rest of their names
+        reindexed = self.store.get_symbols_in_file("/proj/src/file3.cpp")
+        self.store.remove_file("/proj/src/file3.cpp")
+        self.store.bulk_write_symbols(list(reindexed), [], [])
+        self.test_indexed_search_matches_full_scan()
+        # Caught up without retokenizing the whole index
+        self.assertEqual(len(self.engine.signature_index._snapshot.functions), 601 + len(reindexed))
+
+
+class TestSignatureAliasExpansion(unittest.TestCase):
+    def test_alias_expands_to_canonical_and_back(self):
+        cache = FakeAliasCache()
+        self.assertEqual(
+            expand_signature_pattern("const ErrorCallback &", cache),
+            ("const ErrorCallback &", "const std::function<void(int)> &"),
+        )
+        self.assertIn("ErrorCallback", expand_signature_pattern("std::function<void(int)>", cache))
+        self.assertEqual(expand_signature_pattern("int x", cache), "int x")
+        self.assertEqual(expand_signature_pattern("int x", None), "int x")
+
+    def test_search_finds_functions_spelling_the_canonical_type(self):
+        store = _make_store(0)
+        alias_user = _function(1, name="onError", signature="void onError(ErrorCallback cb)")
+        canonical_user = _function(
+            2, name="setCallback", signature="void setCallback(std::function<void(int)> cb)"
+        )
+        store.bulk_write_symbols([alias_user, canonical_user], [], [])
+        engine = SearchEngine(symbol_store=store, cache_manager=FakeAliasCache())
+
+        results = engine.search_functions(
+            SearchCriteria(pattern="", signature_pattern="(ErrorCallback", project_only=False)
+        )
+        self.assertEqual(
+            sorted(r["qualified_name"] for r in results), ["app::onError", "app::setCallback"]
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -460,3 +460,69 @@ class TestSmartFallbackCascade:
             function_index=self.func_index,
         )
         assert result is None
+
+
+class TestSmartFallbackMisspelling:
+    """Test edit-distance suggestions and the analysis time budget."""
+
+    def setup_method(self):
+        self.fb = SmartFallback()
+        self.func_index = _make_index(
+            ("processData", "app::processData", "app.cpp", 3),
+            ("processData", "lib::io::processData", "io.cpp", 8),
+            ("parseHeader", "app::parseHeader", "app.cpp", 20),
+        )
+
+    def test_misspelled_name(self):
+        result = self.fb.analyze_empty_result(
+            pattern="procesData",
+            tool_name="search_functions",
+            class_index={},
+            function_index=self.func_index,
+        )
+        assert result is not None
+        assert result.reason == "fuzzy_match"
+        assert result.suggested_pattern == "processData"
+        assert len(result.alternatives) == 2
+
+    def test_distance_two(self):
+        result = self.fb.analyze_empty_result(
+            pattern="parseHaeder_",
+            tool_name="search_functions",
+            class_index={},
+            function_index=self.func_index,
+        )
+        assert result is not None
+        assert result.suggested_pattern == "parseHeader"
+
+    def test_misspelled_qualified_name_keeps_prefix(self):
+        result = self.fb.analyze_empty_result(
+            pattern="app::procesData",
+            tool_name="search_functions",
+            class_index={},
+            function_index=self.func_index,
+        )
+        assert result is not None
+        assert result.reason == "fuzzy_match"
+        assert result.suggested_pattern == "app::processData"
+
+    def test_qualified_fallback_ranks_namespace_suffix(self):
+        result = self.fb.analyze_empty_result(
+            pattern="other::io::processData",
+            tool_name="search_functions",
+            class_index={},
+            function_index=self.func_index,
+        )
+        assert result is not None
+        assert result.reason == "qualified_fallback"
+        assert result.alternatives[0]["qualified_name"] == "lib::io::processData"
+
+    def test_exhausted_budget_skips_later_detectors(self):
+        fb = SmartFallback(time_budget_ms=0)
+        result = fb.analyze_empty_result(
+            pattern="procesData",
+            tool_name="search_functions",
+            class_index={},
+            function_index=self.func_index,
+        )
+        assert result is None
@@ -0,0 +1,101 @@
+"""
+Tests for the template specialization registry (primary template USR ->
+specializations), kept in step with the USR index.
+"""
+
+import json
+import threading
+import unittest
+from unittest.mock import MagicMock
+
+from clang_index_mcp._symbols.symbol_extractor import SymbolExtractor
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+from tests.utils.test_helpers import class_symbol
+
+HOLDER = "c:@N@app@ST>1#T@Holder"
+
+
+PRIMARY = class_symbol(
+    "Holder",
+    ["T"],
+    kind="class_template",
+    usr=HOLDER,
+    template_parameters=json.dumps([{"name": "T", "kind": "type"}]),
+)
+PARTIAL = class_symbol(
+    "Holder",
+    usr="c:@N@app@SP>1#T@Holder>#*t0.0",
+    kind="partial_specialization",
+    primary_template_usr=HOLDER,
+)
+
+
+def _instantiation(arg, file="/proj/use.cpp"):
+    return class_symbol(
+        "Holder",
+        usr=f"c:@N@app@S@Holder>#$@N@app@S@{arg}",
+        file=file,
+        primary_template_usr=HOLDER,
+        is_template_specialization=True,
+        template_arguments=json.dumps([f"app::{arg}"]),
+    )
+
+
+class TestSpecializationRegistry(unittest.TestCase):
+    def setUp(self):
+        self.store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=MagicMock(),
+        )
+        self.store.bulk_write_symbols(
+            [PRIMARY, PARTIAL, _instantiation("Sensor"), _instantiation("Motor", "/proj/m.cpp")],
+            [],
+            [],
+        )
+
+    def _spec_usrs(self):
+        return [s.usr for s in self.store.iter_template_specializations()]
+
+    def test_specializations_by_primary(self):
+        specs = self.store.iter_template_specializations()
+        self.assertEqual({s.primary_template_usr for s in specs}, {HOLDER})
+        self.assertEqual(
+            sorted((s.kind, s.template_arguments) for s in specs),
+            [
+                ("class", '["app::Motor"]'),
+                ("class", '["app::Sensor"]'),
+                ("partial_specialization", None),
+            ],
+        )
+
+    def test_removal_and_clear(self):
+        self.store.remove_file("/proj/m.cpp")
+        self.assertNotIn(_instantiation("Motor").usr, self._spec_usrs())
+        self.assertEqual(len(self._spec_usrs()), 2)
+        self.store.clear_all_indexes()
+        self.assertEqual(self._spec_usrs(), [])
+
+    def test_rebuilt_with_usr_index(self):
+        loaded = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=MagicMock(),
+            call_graph_port=MagicMock(),
+        )
+        loaded.populate_indexes_from_cache({"class_index": dict(self.store.class_index)})
+        loaded.rebuild_auxiliary_structures()
+        self.assertEqual(len(loaded.iter_template_specializations()), 3)
+
+    def test_deferred_bases_resolved_from_registry(self):
+        extractor = SymbolExtractor(self.store, MagicMock(), MagicMock(), MagicMock(), MagicMock())
+        self.assertEqual(extractor.resolve_deferred_instantiation_bases(), 2)
+        sensor = self.store.usr_index[_instantiation("Sensor").usr]
+        self.assertEqual(sensor.base_classes, ["app::Sensor"])
+        self.assertIn(sensor, self.store.get_derived_class_candidates("Sensor"))
+        self.assertEqual(extractor.resolve_deferred_instantiation_bases(), 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
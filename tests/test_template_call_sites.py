@@ -0,0 +1,178 @@
+"""
+Tests for the template type index of call sites (call_site_template_types).
+
+Calls such as std::make_shared<app::Sensor>() are linked to each project type
+in their template_project_types, so "where is Sensor instantiated through a
+template" is answered through the index instead of decoding the JSON column
+of every call site.
+"""
+
+import json
+import shutil
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+from types import SimpleNamespace
+from unittest.mock import MagicMock
+
+from clang_index_mcp._persistence.sqlite_cache_backend import SqliteCacheBackend
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._symbols.model import SymbolInfo, short_type_name
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+
+MAKE_SHARED = "c:@N@std@F@make_shared"
+MAKE_UNIQUE = "c:@N@std@F@make_unique"
+
+
+def _usr(name):
+    return f"c:@F@{name}"
+
+
+def _site(caller, callee, file, line, display_name=None, types=None):
+    return {
+        "caller_usr": _usr(caller),
+        "callee_usr": callee,
+        "file": file,
+        "line": line,
+        "column": 5,
+        "display_name": display_name,
+        "template_project_types": json.dumps(types) if types else None,
+    }
+
+
+A_CPP = [
+    _site(
+        "create", MAKE_SHARED, "/proj/a.cpp", 10, "std::make_shared<app::Sensor>", ["app::Sensor"]
+    ),
+    _site(
+        "create",
+        MAKE_SHARED,
+        "/proj/a.cpp",
+        12,
+        "std::make_shared<app::Pair<app::Sensor, app::Box>>",
+        ["app::Pair<app::Sensor, app::Box>", "app::Sensor", "app::Box"],
+    ),
+    _site("create", _usr("log"), "/proj/a.cpp", 14),
+]
+B_CPP = [
+    _site("run", MAKE_UNIQUE, "/proj/b.cpp", 3, "std::make_unique<app::Sensor>", ["app::Sensor"]),
+]
+
+
+class TestTemplateTypeIndex(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(A_CPP)
+        self.backend.save_call_sites_batch(B_CPP)
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def _lines(self, type_name):
+        return [
+            (cs["file"], cs["line"])
+            for cs in self.backend.get_call_sites_for_template_type(type_name)
+        ]
+
+    def test_short_type_name(self):
+        self.assertEqual(short_type_name("app::Sensor"), "Sensor")
+        self.assertEqual(short_type_name("app::Pair<app::Sensor, app::Box>"), "Pair")
+        self.assertEqual(short_type_name("Sensor"), "Sensor")
+
+    def test_lookup_by_qualified_and_short_name(self):
+        expected = [("/proj/a.cpp", 10), ("/proj/a.cpp", 12), ("/proj/b.cpp", 3)]
+        self.assertEqual(self._lines("app::Sensor"), expected)
+        self.assertEqual(self._lines("Sensor"), expected)
+        self.assertEqual(self._lines("Pair"), [("/proj/a.cpp", 12)])
+        self.assertEqual(self._lines("Missing"), [])
+
+        row = self.backend.get_call_sites_for_template_type("Box")[0]
+        self.assertEqual(row["caller_usr"], _usr("create"))
+        self.assertEqual(row["callee_usr"], MAKE_SHARED)
+        self.assertEqual(json.loads(row["template_project_types"])[2], "app::Box")
+
+    def test_deletes_unlink_types(self):
+        self.backend.delete_call_sites_by_file("/proj/a.cpp")
+        self.assertEqual(self._lines("Sensor"), [("/proj/b.cpp", 3)])
+        self.backend.delete_call_sites_by_usrs([_usr("run")])
+        self.assertEqual(self._lines("Sensor"), [])
+        links = self.backend.conn.execute(
+            "SELECT COUNT(*) FROM call_site_template_types"
+        ).fetchone()[0]
+        self.assertEqual(links, 0)
+
+
+class TestFindTemplateCallSites(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(A_CPP)
+
+        cache_manager = SimpleNamespace(backend=self.backend, cache_dir=self.test_dir)
+        store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=cache_manager,
+            call_graph_port=MagicMock(),
+        )
+        store.bulk_write_symbols(
+            [
+                SymbolInfo(
+                    name="create",
+                    kind="method",
+                    file="/proj/a.cpp",
+                    line=8,
+                    column=1,
+                    qualified_name="app::Registry::create",
+                    parent_class="Registry",
+                    is_project=True,
+                    is_definition=True,
+                    usr=_usr("create"),
+                )
+            ],
+            [],
+            [],
+        )
+        self.service = CallGraphService(cache_manager)
+        self.service.setup_cache_backend()
+        self.service.set_dependencies(store, MagicMock())
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def test_merges_session_sites_and_filters_by_function(self):
+        # Session call site not saved to SQLite yet
+        site = B_CPP[0]
+        self.service.call_graph_analyzer.add_call(
+            site["caller_usr"],
+            site["callee_usr"],
+            site["file"],
+            site["line"],
+            site["column"],
+            display_name=site["display_name"],
+            template_project_types=site["template_project_types"],
+        )
+
+        result = self.service.find_template_call_sites("Sensor")
+        self.assertEqual(result["total"], 3)
+        self.assertEqual(
+            [(cs["caller"], cs["line"]) for cs in result["call_sites"]],
+            [("app::Registry::create", 10), ("app::Registry::create", 12), ("run", 3)],
+        )
+
+        shared = self.service.find_template_call_sites("app::Sensor", "std::make_shared")
+        self.assertEqual(shared["function"], "std::make_shared")
+        self.assertEqual([cs["line"] for cs in shared["call_sites"]], [10, 12])
+        self.assertEqual(shared["call_sites"][0]["target"], "std::make_shared<app::Sensor>")
+        self.assertEqual(shared["call_sites"][0]["template_types"], ["app::Sensor"])
+
+        unique = self.service.find_template_call_sites("Sensor", "make_unique")
+        self.assertEqual([cs["file"] for cs in unique["call_sites"]], ["/proj/b.cpp"])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -80,6 +80,10 @@ class TestBuildParamMapping:
             "Allocator": "std::allocator<std::string>",
         }
 
+    def test_mapping_from_names(self):
+        result = TemplateResolver.build_param_mapping_from_names(("", "T", "N"), ["int", "float"])
+        assert result == {"T": "float"}
+
 
 class TestSubstituteInBases:
     """Test substitute_in_bases."""
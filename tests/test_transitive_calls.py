@@ -0,0 +1,166 @@
+"""
+Tests for transitive caller/callee queries (CallGraphService.find_transitive_*).
+
+The CSR snapshot, the recursive CTE over call_sites and the per-node BFS
+over the analyzer must all report the same functions at the same depths.
+"""
+
+import shutil
+import tempfile
+import unittest
+from pathlib import Path
+from types import SimpleNamespace
+
+from clang_index_mcp._persistence.sqlite_cache_backend import SqliteCacheBackend
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._symbols.model import SymbolInfo
+
+# main -> parse -> lex, main -> run -> step -> run (cycle), run -> log, parse -> log,
+# log -> fmt (external)
+EDGES = [
+    ("main", "parse"),
+    ("parse", "lex"),
+    ("main", "run"),
+    ("run", "step"),
+    ("step", "run"),
+    ("run", "log"),
+    ("parse", "log"),
+    ("log", "fmt"),
+]
+FILES = {"main": "main.cpp", "parse": "parse.cpp", "lex": "parse.cpp", "run": "run.cpp"}
+
+
+def _usr(name):
+    return f"c:@F@{name}"
+
+
+def _symbol(name):
+    return SymbolInfo(
+        name=name,
+        kind="function",
+        file=f"/proj/{FILES.get(name, 'util.cpp')}",
+        line=len(name),
+        column=1,
+        qualified_name=name,
+        is_project=name != "fmt",
+        usr=_usr(name),
+    )
+
+
+class FakeSymbolStore:
+    def __init__(self):
+        self.generation = 1
+        self.symbols = {_usr(n): _symbol(n) for edge in EDGES for n in edge}
+
+    def get_symbols_by_usrs(self, usrs):
+        return {usr: self.symbols[usr] for usr in usrs if usr in self.symbols}
+
+    def get_functions_by_name(self, name):
+        symbol = self.symbols.get(_usr(name))
+        return [symbol] if symbol else []
+
+
+class FakeQueryEngine:
+    def __init__(self, store):
+        self.store = store
+
+    def search_functions(self, name, project_only=False, class_name=""):
+        return [
+            {
+                "qualified_name": s.qualified_name,
+                "definition": {"file": s.file, "line": s.line},
+            }
+            for s in self.store.get_functions_by_name(name)
+        ]
+
+
+class TestTransitiveCalls(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_call_sites_batch(
+            [
+                {"caller_usr": _usr(a), "callee_usr": _usr(b), "file": "a.cpp", "line": i + 1}
+                for i, (a, b) in enumerate(EDGES)
+            ]
+        )
+        self.service = CallGraphService(
+            SimpleNamespace(backend=self.backend, cache_dir=self.test_dir)
+        )
+        self.service.setup_cache_backend()
+        store = FakeSymbolStore()
+        self.service.set_dependencies(store, FakeQueryEngine(store))
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    @staticmethod
+    def _levels(result):
+        return [
+            (level["depth"], [f["qualified_name"] for f in level["functions"]])
+            for level in result["by_depth"]
+        ]
+
+    def _all_strategies(self, query):
+        """Run query via the CTE, the snapshot and the analyzer BFS; return the three results."""
+        self.assertIsNone(self.service.call_graph_snapshot(build=False))
+        via_cte = query()
+        self.service.refresh_call_graph_snapshot()
+        via_snapshot = query()
+        self.service.call_graph_analyzer.add_call(_usr("zz"), _usr("main"), "z.cpp", 1)
+        self.assertIsNone(self.service.call_graph_snapshot())
+        via_bfs = query()
+        return via_cte, via_snapshot, via_bfs
+
+    def test_callees_grouped_by_depth_and_file(self):
+        results = self._all_strategies(
+            lambda: self.service.find_transitive_callees("main", max_depth=3)
+        )
+        for result in results:
+            self.assertEqual(
+                self._levels(result),
+                [(1, ["parse", "run"]), (2, ["lex", "log", "step"])],
+            )
+            self.assertEqual(result["total"], 5)
+            self.assertFalse(result["truncated"])
+            self.assertEqual(result["by_file"]["/proj/parse.cpp"], ["lex", "parse"])
+
+    def test_callers_of_external_function(self):
+        results = self._all_strategies(
+            lambda: self.service.find_transitive_callers("fmt", max_depth=10)
+        )
+        for result in results:
+            self.assertEqual(
+                self._levels(result),
+                [(1, ["log"]), (2, ["parse", "run"]), (3, ["main", "step"])],
+            )
+            self.assertTrue(result["_function_found"])
+
+    def test_project_only_filter(self):
+        results = self._all_strategies(
+            lambda: self.service.find_transitive_callees("run", max_depth=5, project_only=False)
+        )
+        for result in results:
+            self.assertEqual(self._levels(result), [(1, ["log", "step"]), (2, ["fmt"])])
+        projected = self.service.find_transitive_callees("run", max_depth=5)
+        self.assertEqual(self._levels(projected), [(1, ["log", "step"])])
+
+    def test_node_budget_truncates(self):
+        results = self._all_strategies(
+            lambda: self.service.find_transitive_callees("main", max_depth=10, max_nodes=3)
+        )
+        for result in results:
+            self.assertTrue(result["truncated"])
+            self.assertEqual(result["total"], 3)
+            self.assertEqual(result["by_depth"][0]["depth"], 1)
+
+    def test_unknown_function(self):
+        result = self.service.find_transitive_callers("missing")
+        self.assertFalse(result["_function_found"])
+        self.assertEqual(result["by_depth"], [])
+        self.assertEqual(result["total"], 0)
+
+
+if __name__ == "__main__":
+    unittest.main()
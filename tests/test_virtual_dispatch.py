@@ -0,0 +1,221 @@
+"""
+Tests for the method override table (method_overrides), virtual dispatch
+in find_incoming_calls and find_overrides.
+
+Overrides are recorded at index time from SymbolInfo.overridden_usrs, so the
+callers of a base class virtual can be added to an override's callers without
+walking the class hierarchy.
+"""
+
+import shutil
+import tempfile
+import threading
+import unittest
+from pathlib import Path
+from types import SimpleNamespace
+from unittest.mock import MagicMock
+
+from clang_index_mcp._persistence.sqlite_cache_backend import SqliteCacheBackend
+from clang_index_mcp._search.call_graph_service import CallGraphService
+from clang_index_mcp._symbols.model import SymbolInfo
+from clang_index_mcp._symbols.symbol_index_store import SymbolIndexStore
+from clang_index_mcp.cpp_analyzer import CppAnalyzer
+
+
+def _usr(cls, name="draw"):
+    return f"c:@S@{cls}@F@{name}#"
+
+
+def _method(cls, line, overrides=(), file="/proj/shapes.h", name="draw"):
+    return SymbolInfo(
+        name=name,
+        kind="method",
+        file=file,
+        line=line,
+        column=1,
+        qualified_name=f"{cls}::{name}",
+        parent_class=cls,
+        is_project=True,
+        is_virtual=True,
+        usr=_usr(cls, name),
+        overridden_usrs=[_usr(base, name) for base in overrides],
+    )
+
+
+def _function(name, line):
+    return SymbolInfo(
+        name=name,
+        kind="function",
+        file="/proj/main.cpp",
+        line=line,
+        column=1,
+        qualified_name=name,
+        is_project=True,
+        usr=f"c:@F@{name}",
+    )
+
+
+# Shape <- Circle <- Ring; Ring is parsed in this session and not saved yet
+SHAPE = _method("Shape", 10)
+CIRCLE = _method("Circle", 20, overrides=["Shape"])
+RING = _method("Ring", 30, overrides=["Circle"], file="/proj/ring.h")
+
+
+class TestMethodOverrides(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_symbols_batch([SHAPE, CIRCLE, RING])
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def test_overridden_methods_are_transitive(self):
+        self.assertEqual(
+            self.backend.get_overridden_methods([_usr("Ring")]), {_usr("Circle"), _usr("Shape")}
+        )
+        self.assertEqual(self.backend.get_overridden_methods([_usr("Circle")]), {_usr("Shape")})
+        self.assertEqual(self.backend.get_overridden_methods([_usr("Shape")]), set())
+
+    def test_resaving_loaded_symbols_keeps_overrides(self):
+        # Symbols loaded back from SQLite carry no overridden_usrs
+        loaded = self.backend.load_symbol_by_usr(_usr("Circle"))
+        self.assertEqual(loaded.overridden_usrs, [])
+        self.backend.save_symbols_batch([loaded])
+        self.assertEqual(self.backend.get_overridden_methods([_usr("Circle")]), {_usr("Shape")})
+
+    def test_file_delete_removes_overrides(self):
+        self.backend.delete_symbols_by_file("/proj/ring.h")
+        self.assertEqual(self.backend.get_overridden_methods([_usr("Ring")]), set())
+        self.assertEqual(self.backend.get_overridden_methods([_usr("Circle")]), {_usr("Shape")})
+
+
+    def test_overriding_methods_are_transitive(self):
+        self.assertEqual(
+            self.backend.get_overriding_methods([_usr("Shape")]),
+            [(_usr("Circle"), _usr("Shape")), (_usr("Ring"), _usr("Circle"))],
+        )
+        self.assertEqual(self.backend.get_overriding_methods([_usr("Ring")]), [])
+        self.backend.delete_symbols_by_file("/proj/ring.h")
+        self.assertEqual(
+            self.backend.get_overriding_methods([_usr("Shape")]),
+            [(_usr("Circle"), _usr("Shape"))],
+        )
+
+
+class FakeQueryEngine:
+    def search_functions(self, name, project_only=False, class_name=""):
+        return [
+            {"qualified_name": s.qualified_name, "definition": {"file": s.file, "line": s.line}}
+            for s in (SHAPE, CIRCLE, RING)
+            if s.name == name and s.parent_class == class_name
+        ]
+
+
+class TestVirtualDispatchCallers(unittest.TestCase):
+    def setUp(self):
+        self.test_dir = Path(tempfile.mkdtemp())
+        self.backend = SqliteCacheBackend(self.test_dir / "symbols.db")
+        self.backend.save_symbols_batch([SHAPE, CIRCLE])
+        self.backend.save_call_sites_batch(
+            [
+                {"caller_usr": caller, "callee_usr": callee, "file": "/proj/main.cpp", "line": line}
+                for caller, callee, line in (
+                    ("c:@F@render", _usr("Shape"), 5),
+                    ("c:@F@paint", _usr("Circle"), 8),
+                )
+            ]
+        )
+        cache_manager = SimpleNamespace(backend=self.backend, cache_dir=self.test_dir)
+        self.store = SymbolIndexStore(
+            lock_provider=threading.RLock(),
+            alias_persistence=MagicMock(),
+            cache_manager=cache_manager,
+            call_graph_port=MagicMock(),
+        )
+        self.store.bulk_write_symbols(
+            [RING, _function("render", 4), _function("paint", 7)], [], []
+        )
+        self.service = CallGraphService(cache_manager)
+        self.service.setup_cache_backend()
+        self.service.set_dependencies(self.store, FakeQueryEngine())
+        self.service.call_graph_analyzer.add_call("c:@F@paint", _usr("Ring"), "/proj/main.cpp", 9)
+
+    def tearDown(self):
+        self.backend.close()
+        shutil.rmtree(self.test_dir)
+
+    def test_find_overrides(self):
+        # Badge overrides two unrelated bases; Ring is not saved yet
+        extra = [_method("Badge", 40, overrides=["Shape", "Printable"]), _method("Printable", 50)]
+        self.backend.save_symbols_batch(extra)
+        self.store.bulk_write_symbols([SHAPE, CIRCLE] + extra, [], [])
+        result = self.service.find_overrides("draw", "Shape")
+        self.assertEqual(result["method"], ["Shape::draw"])
+        self.assertEqual(
+            [(o["qualified_name"], o["line"], o["overrides"]) for o in result["overrides"]],
+            [
+                ("Circle::draw", 20, ["Shape::draw"]),
+                # Only the overridden methods within the queried hierarchy
+                ("Badge::draw", 40, ["Shape::draw"]),
+            ],
+        )
+        self.assertEqual(result["total"], 2)
+        self.assertTrue(result["_function_found"])
+        self.assertEqual(self.service.find_overrides("draw", "Circle")["overrides"], [])
+        self.assertFalse(self.service.find_overrides("draw", "Missing")["_function_found"])
+
+    def test_static_callers_only_by_default(self):
+        result = self.service.find_incoming_calls("draw", "Ring")
+        self.assertEqual([c["qualified_name"] for c in result["callers"]], ["paint"])
+        self.assertNotIn("via_virtual", result["callers"][0])
+
+    def test_dispatch_adds_base_class_callers(self):
+        result = self.service.find_incoming_calls("draw", "Ring", include_virtual_dispatch=True)
+        self.assertEqual(
+            sorted((c["qualified_name"], c.get("via_virtual", "")) for c in result["callers"]),
+            [("paint", ""), ("paint", "Circle::draw"), ("render", "Shape::draw")],
+        )
+        self.assertEqual(
+            [(cs["line"], cs.get("via_virtual")) for cs in result["call_sites"]],
+            [(5, "Shape::draw"), (8, "Circle::draw"), (9, None)],
+        )
+
+
+class TestOverridesFromLibclang(unittest.TestCase):
+    """overridden_usrs as recorded by the parser (clang_getOverriddenCursors)."""
+
+    def setUp(self):
+        self.project = Path(tempfile.mkdtemp())
+
+    def tearDown(self):
+        shutil.rmtree(self.project)
+
+    def test_override_records_base_method(self):
+        header = self.project / "shapes.h"
+        header.write_text("""
+class Base {
+public:
+    virtual void draw();
+    virtual ~Base();
+};
+
+class Derived : public Base {
+public:
+    void draw() override;
+};
+""")
+        analyzer = CppAnalyzer(project_root=str(self.project))
+        analyzer.index_file(str(header))
+        methods = {
+            info.qualified_name: info
+            for info in analyzer.context.symbol_store.function_index["draw"]
+        }
+        base, derived = methods["Base::draw"], methods["Derived::draw"]
+        self.assertEqual(derived.overridden_usrs, [base.usr])
+        self.assertEqual(base.overridden_usrs, [])
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -14,7 +14,7 @@ import sys
 import tempfile
 from contextlib import contextmanager
 from pathlib import Path
-from typing import Any, Dict, List, Optional
+from typing import Any, Dict, List, Optional, Sequence
 
 project_root = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
 if project_root not in sys.path:
@@ -30,6 +30,8 @@ except SystemExit:
     CppAnalyzer = None
     CLANG_AVAILABLE = False
 
+from clang_index_mcp._symbols.model import SymbolInfo
+
 
 @contextmanager
 def temp_project(name: str = "test_project", create_subdirs: bool = True):
@@ -371,3 +373,44 @@ def cleanup_temp_analyzer(analyzer: CppAnalyzer):
         project_path = Path(analyzer.project_root)
         if project_path.exists() and "tmp" in str(project_path):
             shutil.rmtree(project_path, ignore_errors=True)
+
+
+def class_symbol(
+    name: str,
+    bases: Sequence[str] = (),
+    kind: str = "class",
+    file: str = "/proj/a.h",
+    ns: str = "app",
+    usr: Optional[str] = None,
+    is_project: bool = True,
+    **fields: Any,
+) -> SymbolInfo:
+    """
+    Create the SymbolInfo of a class definition, for in-memory index tests.
+
+    Args:
+        name: Simple class name (qualified as ns::name)
+        bases: Base class names as written in the source
+        kind: Symbol kind ("class", "class_template", ...)
+        file: File declaring the class
+        ns: Enclosing namespace
+        usr: USR (default: derived from ns and name)
+        is_project: Whether the class belongs to the project
+        **fields: Further SymbolInfo fields (template_parameters, ...)
+
+    Example:
+        store.bulk_write_symbols([class_symbol("Base"), class_symbol("Derived", ["Base"])], [], [])
+    """
+    return SymbolInfo(
+        name=name,
+        kind=kind,
+        file=file,
+        line=1,
+        column=1,
+        qualified_name=f"{ns}::{name}",
+        is_project=is_project,
+        is_definition=True,
+        usr=usr if usr is not None else f"c:@N@{ns}@S@{name}",
+        base_classes=list(bases),
+        **fields,
+    )